@@ -0,0 +1,135 @@
+#ifndef ADVENT_DAY_H
+#define ADVENT_DAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "input_buffer.h"
+#include "thread_pool.h"
+#include "trace.h"
+
+struct Diagnostic {
+    std::string label;
+    std::optional<int64_t> value;
+};
+
+// Answers produced by AdventDay::solve(). A part a day does not implement
+// is left empty; diagnostics carry anything else worth reporting.
+struct DayResult {
+    std::optional<int64_t> part_one;
+    std::optional<int64_t> part_two;
+    std::vector<Diagnostic> diagnostics;
+};
+
+class AdventDay {
+    public:
+        explicit AdventDay(const std::string& input_file_path) : input_file_path(input_file_path) {}
+        virtual ~AdventDay() = default;
+
+        // parseInput() rebuilds the day's state from scratch and solve() only
+        // reads it, so either phase can be repeated on its own.
+        virtual void parseInput() = 0;
+        virtual DayResult solve() = 0;
+
+        // Phase entry points. Each phase starts from an empty arena, so
+        // temporaries of the previous phase are dropped in one go.
+        void runParse() {
+            ADVENT_TRACE_SCOPE_ARG("parse", input_file_path);
+            resetArena();
+            parseInput();
+        }
+
+        DayResult runSolve() {
+            ADVENT_TRACE_SCOPE_ARG("solve", input_file_path);
+            resetArena();
+            return solve();
+        }
+
+        DayResult run() {
+            runParse();
+            return runSolve();
+        }
+
+        const std::string& inputPath() const { return input_file_path; }
+
+        // Points the day at another input, possibly already mapped (batch runs
+        // load the next file while the current one is solved). The next
+        // parseInput() starts over from it.
+        void setInput(const std::string& path, InputBuffer buffer = {}) {
+            input_file_path = path;
+            input_buffer = std::move(buffer);
+        }
+
+        // Worker threads a day may use inside its own phases. Days that do
+        // not split their work ignore it.
+        void setThreadCount(unsigned count) {
+            if (count != thread_count) {
+                worker_pool.reset();
+            }
+            thread_count = count == 0 ? 1 : count;
+        }
+
+        // Upper bound, in bytes, on the working memory of days that can spill
+        // to disk (currently Day One). Zero means no limit. Other days ignore it.
+        void setMemoryBudget(size_t bytes) { memory_budget = bytes; }
+
+        // Extra words to search for (currently Day Four, which reports a
+        // count per word as diagnostics). Other days ignore them.
+        void setWordList(std::vector<std::string> words) { word_list = std::move(words); }
+
+        // Size of the mapped input, zero until parseInput() has run.
+        size_t inputSize() const { return input_buffer.size(); }
+
+    protected:
+        std::string input_file_path;
+        InputBuffer input_buffer;
+        size_t memory_budget = 0;
+        std::vector<std::string> word_list;
+
+        // Maps the input file on first use; later calls reuse the mapping.
+        bool loadInput() {
+            return input_buffer.isOpen() || input_buffer.open(input_file_path);
+        }
+
+        // Memory for node-based temporaries (std::pmr containers) built during
+        // a phase. Freed nodes are recycled by the pool and everything is
+        // handed back at the next phase, so the solvers rarely reach malloc.
+        // Not thread-safe: parallel workers need their own resource.
+        std::pmr::memory_resource* arena() const { return &arena_pool; }
+
+        unsigned threadCount() const { return thread_count; }
+
+        // The day's worker pool, started on first use with threadCount()
+        // threads and kept for later phases and inputs.
+        ThreadPool& workers() {
+            if (!worker_pool) {
+                worker_pool = std::make_unique<ThreadPool>(thread_count);
+            }
+            return *worker_pool;
+        }
+
+        void resetArena() {
+            arena_pool.release();
+            arena_blocks.release();
+        }
+
+    private:
+        static constexpr size_t kArenaInitialBytes = 1 << 20;
+
+        unsigned thread_count = 1;
+        std::unique_ptr<ThreadPool> worker_pool;
+
+        // The first block is kept across resets; blocks added when a phase
+        // outgrows it are returned to the system on reset.
+        std::unique_ptr<std::byte[]> arena_initial{new std::byte[kArenaInitialBytes]};
+        mutable std::pmr::monotonic_buffer_resource arena_blocks{arena_initial.get(), kArenaInitialBytes};
+        mutable std::pmr::unsynchronized_pool_resource arena_pool{&arena_blocks};
+};
+
+#endif // ADVENT_DAY_H
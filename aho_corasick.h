@@ -0,0 +1,120 @@
+#ifndef ADVENT_AHO_CORASICK_H
+#define ADVENT_AHO_CORASICK_H
+
+#include <array>
+#include <cstdint>
+#include <queue>
+#include <string>
+#include <vector>
+
+// Aho-Corasick automaton over a fixed set of patterns: feed text one byte at
+// a time through next() and every pattern ending at that byte is reported by
+// forEachMatch(), so any number of patterns is found in a single pass.
+//
+// Transitions are a dense table over the bytes that occur in the patterns;
+// every other byte leads back to the start state. Patterns may repeat, and
+// each copy is reported under its own index.
+class AhoCorasick {
+public:
+    explicit AhoCorasick(const std::vector<std::string>& patterns) : pattern_count(patterns.size()) {
+        symbol.fill(0);
+        for (const auto& pattern : patterns) {
+            for (char c : pattern) {
+                auto& slot = symbol[static_cast<unsigned char>(c)];
+                if (slot == 0) {
+                    slot = ++alphabet;
+                }
+            }
+        }
+        width = alphabet + 1;
+
+        // Trie
+        addState();
+        std::vector<std::vector<uint32_t>> ending(1);
+        for (size_t i = 0; i < patterns.size(); ++i) {
+            int state = 0;
+            for (char c : patterns[i]) {
+                size_t edge = static_cast<size_t>(state) * width + symbol[static_cast<unsigned char>(c)];
+                if (transitions[edge] == 0) {
+                    int child = addState();  // may reallocate the table
+                    transitions[edge] = child;
+                    ending.emplace_back();
+                }
+                state = transitions[edge];
+            }
+            ending[state].push_back(static_cast<uint32_t>(i));
+        }
+
+        // Failure links, breadth first, folded into the transition table
+        std::vector<int> fail(states, 0);
+        std::queue<int> pending;
+        for (int s = 1; s < width; ++s) {
+            if (int child = transitions[s]) {
+                pending.push(child);
+            }
+        }
+        while (!pending.empty()) {
+            int state = pending.front();
+            pending.pop();
+            int fallback = fail[state];
+            dictionary_link[state] = ending[fallback].empty() ? dictionary_link[fallback] : fallback;
+            for (int s = 1; s < width; ++s) {
+                int& target = transitions[state * width + s];
+                if (target != 0) {
+                    fail[target] = transitions[fallback * width + s];
+                    pending.push(target);
+                } else {
+                    target = transitions[fallback * width + s];
+                }
+            }
+        }
+
+        match_begin.assign(states + 1, 0);
+        for (int state = 0; state < states; ++state) {
+            match_begin[state + 1] = match_begin[state] + static_cast<uint32_t>(ending[state].size());
+            matches.insert(matches.end(), ending[state].begin(), ending[state].end());
+        }
+    }
+
+    size_t patternCount() const { return pattern_count; }
+
+    static constexpr int start() { return 0; }
+
+    int next(int state, char c) const {
+        return transitions[state * width + symbol[static_cast<unsigned char>(c)]];
+    }
+
+    // Calls f(pattern index) for every pattern ending in `state`
+    template <typename F>
+    void forEachMatch(int state, F&& f) const {
+        if (match_begin[state] == match_begin[state + 1]) {
+            state = dictionary_link[state];
+        }
+        for (; state > 0; state = dictionary_link[state]) {
+            for (uint32_t i = match_begin[state]; i < match_begin[state + 1]; ++i) {
+                f(matches[i]);
+            }
+        }
+    }
+
+private:
+    size_t pattern_count;
+    std::array<int, 256> symbol;  // byte -> column, 0 for bytes in no pattern
+    int alphabet = 0;
+    int width = 1;
+    int states = 0;
+    std::vector<int> transitions;
+    // Nearest proper suffix state where some pattern ends, 0 if none
+    std::vector<int> dictionary_link;
+    // Patterns ending exactly at state s: matches[match_begin[s] .. match_begin[s + 1])
+    std::vector<uint32_t> match_begin;
+    std::vector<uint32_t> matches;
+
+    int addState() {
+        transitions.resize(transitions.size() + width, 0);
+        dictionary_link.push_back(0);
+        return states++;
+    }
+};
+
+#endif // ADVENT_AHO_CORASICK_H
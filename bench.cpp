@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "days.h"
+
+struct BenchOptions {
+    std::vector<int> days;
+    std::string input_path;
+    int warmup = 3;
+    int repetitions = 20;
+    int threads = 1;
+    bool json = false;
+};
+
+struct PhaseStats {
+    int64_t min_ns = 0;
+    int64_t median_ns = 0;
+    int64_t p99_ns = 0;
+    double bytes_per_second = 0.0;
+};
+
+struct DayReport {
+    int number;
+    std::string input_path;
+    size_t input_bytes;
+    PhaseStats parse;
+    PhaseStats solve;
+};
+
+PhaseStats summarize(std::vector<int64_t> samples, size_t bytes) {
+    PhaseStats stats;
+    if (samples.empty()) {
+        return stats;
+    }
+    std::sort(samples.begin(), samples.end());
+
+    size_t n = samples.size();
+    stats.min_ns = samples.front();
+    stats.median_ns = (n % 2 == 1) ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+    // Nearest-rank percentile
+    size_t p99_rank = (n * 99 + 99) / 100;
+    stats.p99_ns = samples[std::min(n, std::max<size_t>(p99_rank, 1)) - 1];
+    if (stats.median_ns > 0) {
+        stats.bytes_per_second = static_cast<double>(bytes) * 1e9 / static_cast<double>(stats.median_ns);
+    }
+    return stats;
+}
+
+template <typename F>
+int64_t timeNs(F&& phase) {
+    auto begin = std::chrono::steady_clock::now();
+    phase();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+}
+
+DayReport benchmarkDay(const DayInfo& info, const BenchOptions& options) {
+    std::string path = options.input_path.empty() ? info.default_input_path : options.input_path;
+    std::unique_ptr<AdventDay> day = info.create(path);
+    day->setThreadCount(static_cast<unsigned>(options.threads));
+
+    for (int i = 0; i < options.warmup; ++i) {
+        day->runParse();
+        day->runSolve();
+    }
+
+    std::vector<int64_t> parse_samples;
+    std::vector<int64_t> solve_samples;
+    parse_samples.reserve(options.repetitions);
+    solve_samples.reserve(options.repetitions);
+    for (int i = 0; i < options.repetitions; ++i) {
+        parse_samples.push_back(timeNs([&] { day->runParse(); }));
+        solve_samples.push_back(timeNs([&] { day->runSolve(); }));
+    }
+
+    size_t bytes = day->inputSize();
+    return {info.number, path, bytes,
+            summarize(std::move(parse_samples), bytes),
+            summarize(std::move(solve_samples), bytes)};
+}
+
+std::string jsonEscape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            static const char* hex = "0123456789abcdef";
+            escaped += "\\u00";
+            escaped += hex[(c >> 4) & 0xf];
+            escaped += hex[c & 0xf];
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+void writePhaseJson(std::ostream& os, const char* name, const PhaseStats& stats) {
+    os << "\"" << name << "\": {"
+       << "\"min_ns\": " << stats.min_ns << ", "
+       << "\"median_ns\": " << stats.median_ns << ", "
+       << "\"p99_ns\": " << stats.p99_ns << ", "
+       << "\"bytes_per_second\": " << std::fixed << std::setprecision(1) << stats.bytes_per_second
+       << "}";
+}
+
+void writeJson(std::ostream& os, const std::vector<DayReport>& reports, const BenchOptions& options) {
+    os << "{\n"
+       << "  \"warmup\": " << options.warmup << ",\n"
+       << "  \"repetitions\": " << options.repetitions << ",\n"
+       << "  \"threads\": " << options.threads << ",\n"
+       << "  \"days\": [";
+    for (size_t i = 0; i < reports.size(); ++i) {
+        const DayReport& report = reports[i];
+        os << (i == 0 ? "\n" : ",\n")
+           << "    {\"day\": " << report.number << ", "
+           << "\"input\": \"" << jsonEscape(report.input_path) << "\", "
+           << "\"bytes\": " << report.input_bytes << ", ";
+        writePhaseJson(os, "parse", report.parse);
+        os << ", ";
+        writePhaseJson(os, "solve", report.solve);
+        os << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+std::string formatDuration(int64_t ns) {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(3);
+    if (ns >= 1'000'000'000) {
+        os << static_cast<double>(ns) / 1e9 << " s";
+    } else if (ns >= 1'000'000) {
+        os << static_cast<double>(ns) / 1e6 << " ms";
+    } else {
+        os << static_cast<double>(ns) / 1e3 << " us";
+    }
+    return os.str();
+}
+
+std::string formatThroughput(double bytes_per_second) {
+    std::ostringstream os;
+    os << std::fixed << std::setprecision(1) << bytes_per_second / (1024.0 * 1024.0) << " MiB/s";
+    return os.str();
+}
+
+// Throughput gets its own gap: tiny phases reach tens of millions of MiB/s
+void writeTable(std::ostream& os, const std::vector<DayReport>& reports) {
+    os << std::left << std::setw(5) << "Day" << std::setw(7) << "Phase"
+       << std::right << std::setw(14) << "min" << std::setw(14) << "median"
+       << std::setw(14) << "p99" << "  " << std::setw(20) << "throughput" << "\n";
+    for (const auto& report : reports) {
+        const std::pair<const char*, const PhaseStats*> phases[] = {
+            {"parse", &report.parse}, {"solve", &report.solve}};
+        for (const auto& [name, stats] : phases) {
+            os << std::left << std::setw(5) << report.number << std::setw(7) << name
+               << std::right << std::setw(14) << formatDuration(stats->min_ns)
+               << std::setw(14) << formatDuration(stats->median_ns)
+               << std::setw(14) << formatDuration(stats->p99_ns)
+               << "  " << std::setw(20) << formatThroughput(stats->bytes_per_second) << "\n";
+        }
+    }
+}
+
+int parseCount(const std::string& flag, const std::string& value, int minimum) {
+    if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos ||
+        value.size() > 9 || std::stoi(value) < minimum) {
+        throw std::invalid_argument("Error: " + flag + " expects an integer >= " +
+                                    std::to_string(minimum) + ", got " + value);
+    }
+    return std::stoi(value);
+}
+
+BenchOptions parseOptions(int argc, char* argv[]) {
+    const std::string usage = "Usage: " + std::string(argv[0]) +
+        " <day...|all> [--input PATH] [--warmup N] [--reps N] [--threads N] [--json]";
+
+    BenchOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--input" && i + 1 < argc) {
+            options.input_path = argv[++i];
+        } else if (arg == "--warmup" && i + 1 < argc) {
+            options.warmup = parseCount(arg, argv[++i], 0);
+        } else if (arg == "--reps" && i + 1 < argc) {
+            options.repetitions = parseCount(arg, argv[++i], 1);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            options.threads = parseCount(arg, argv[++i], 1);
+        } else if (arg == "--json") {
+            options.json = true;
+        } else if (arg == "all") {
+            for (const auto& info : implementedDays()) {
+                options.days.push_back(info.number);
+            }
+        } else if (!arg.empty() && arg.find_first_not_of("0123456789") == std::string::npos &&
+                   arg.size() <= 2 && findDay(std::stoi(arg)) != nullptr) {
+            options.days.push_back(std::stoi(arg));
+        } else {
+            throw std::invalid_argument(usage);
+        }
+    }
+
+    if (options.days.empty()) {
+        throw std::invalid_argument(usage);
+    }
+    if (!options.input_path.empty() && options.days.size() > 1) {
+        throw std::invalid_argument("Error: --input can only be used with a single day");
+    }
+    return options;
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        BenchOptions options = parseOptions(argc, argv);
+
+        std::vector<DayReport> reports;
+        for (int number : options.days) {
+            reports.push_back(benchmarkDay(*findDay(number), options));
+        }
+
+        if (options.json) {
+            writeJson(std::cout, reports, options);
+        } else {
+            writeTable(std::cout, reports);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
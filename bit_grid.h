@@ -0,0 +1,385 @@
+#ifndef ADVENT_BIT_GRID_H
+#define ADVENT_BIT_GRID_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "grid2d.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// One bit per cell of a rows x cols grid, 64 cells to a word, each row
+// padded to whole words. Bit b of word w in a row is column 64 * w + b.
+// Every row also has a zero word on either side, so a window shifted by up
+// to 64 columns past an edge reads zeros without a bounds test.
+class BitPlane {
+public:
+    BitPlane() : BitPlane(0, 0) {}
+
+    BitPlane(int rows, int cols)
+        : rows_(rows), cols_(cols), words_per_row_((cols + 63) / 64), stride_(words_per_row_ + 2),
+          words_(static_cast<size_t>(rows + 1) * stride_, 0) {}
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int wordsPerRow() const { return words_per_row_; }
+
+    void set(int row, int col) {
+        rowWords(row)[col >> 6] |= uint64_t{1} << (col & 63);
+    }
+
+    bool test(int row, int col) const {
+        return (window(row, col) & 1) != 0;
+    }
+
+    // Words of `row`; indices -1 and wordsPerRow() are the zero padding.
+    // Rows outside the grid read as all zeros.
+    const uint64_t* rowWords(int row) const {
+        if (row < 0 || row >= rows_) {
+            row = rows_;
+        }
+        return &words_[static_cast<size_t>(row) * stride_ + 1];
+    }
+
+    uint64_t* rowWords(int row) {
+        return &words_[static_cast<size_t>(row) * stride_ + 1];
+    }
+
+    // Cells [col, col + 64) of `row` as one word, `col` in bit 0. Anything
+    // outside the grid reads as 0.
+    uint64_t window(int row, int col) const {
+        int word = col >> 6;  // floor division, also for negative columns
+        if (word < -1 || word > words_per_row_) {
+            return 0;
+        }
+        const uint64_t* words = rowWords(row);
+        uint64_t high = word < words_per_row_ ? words[word + 1] : 0;
+        return funnelShift(words[word], high, col & 63);
+    }
+
+    // Bits [shift, shift + 64) of the 128-bit value high:low
+    static uint64_t funnelShift(uint64_t low, uint64_t high, int shift) {
+        return shift == 0 ? low : (low >> shift) | (high << (64 - shift));
+    }
+
+private:
+    int rows_ = 0;
+    int cols_ = 0;
+    int words_per_row_ = 0;
+    int stride_ = 0;
+    // One extra all-zero row at the end stands in for rows off the grid
+    std::vector<uint64_t> words_;
+};
+
+// A BitPlane per letter of interest, marking where that letter sits in a
+// character grid. Letters that were not asked for read as an empty plane.
+class LetterPlanes {
+public:
+    LetterPlanes() { index.fill(-1); }
+
+    LetterPlanes(const Grid2D<char>& grid, std::string_view letters) : LetterPlanes() {
+        rows_ = grid.rows();
+        cols_ = grid.cols();
+        empty = BitPlane(rows_, cols_);
+        std::vector<char> distinct;
+        for (char letter : letters) {
+            auto& slot = index[static_cast<unsigned char>(letter)];
+            if (slot < 0) {
+                slot = static_cast<int>(planes.size());
+                planes.emplace_back(rows_, cols_);
+                distinct.push_back(letter);
+            }
+        }
+
+        // 64 cells at a time per letter: compare, then pack the matches
+        for (int r = 0; r < rows_; ++r) {
+            const char* row = &grid(r, 0);
+            for (int c = 0; c < cols_; c += 64) {
+                int width = std::min(64, cols_ - c);
+                for (size_t i = 0; i < distinct.size(); ++i) {
+                    planes[i].rowWords(r)[c >> 6] = matchMask(row + c, width, distinct[i]);
+                }
+            }
+        }
+    }
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int wordsPerRow() const { return (cols_ + 63) / 64; }
+
+    const BitPlane& plane(char letter) const {
+        int slot = index[static_cast<unsigned char>(letter)];
+        return slot < 0 ? empty : planes[slot];
+    }
+
+private:
+    int rows_ = 0;
+    int cols_ = 0;
+    std::array<int, 256> index;
+    std::vector<BitPlane> planes;
+    BitPlane empty;
+
+    // Bit i set when cells[i] == letter, for i < width (at most 64)
+    static uint64_t matchMask(const char* cells, int width, char letter) {
+        uint64_t mask = 0;
+        int i = 0;
+#if defined(__SSE2__)
+        const __m128i wanted = _mm_set1_epi8(letter);
+        for (; i + 16 <= width; i += 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cells + i));
+            uint64_t bits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, wanted)));
+            mask |= bits << i;
+        }
+#endif
+        for (; i < width; ++i) {
+            mask |= static_cast<uint64_t>(cells[i] == letter) << i;
+        }
+        return mask;
+    }
+};
+
+// Counts `word` read in each of the eight directions, starting in rows
+// [row_begin, row_end). For each direction and each 64-cell word of a row,
+// the planes of the word's letters are ANDed at the matching shifts; every
+// bit left standing is the first letter of a match. A word that reads the
+// same both ways is counted once per direction, like the letter-by-letter
+// search it replaces.
+inline int64_t countWordMatches(const LetterPlanes& planes, std::string_view word,
+                                int row_begin, int row_end) {
+    static constexpr int kDirections[8][2] = {
+        {0, 1}, {1, 0}, {1, 1}, {1, -1}, {0, -1}, {-1, 0}, {-1, 1}, {-1, -1}};
+    if (word.empty()) {
+        return 0;
+    }
+
+    const int words_per_row = planes.wordsPerRow();
+    const int length = static_cast<int>(word.size());
+    if (length > 64) {
+        // Shifts beyond the one word of padding: take the bounds-checked path
+        int64_t count = 0;
+        for (const auto& direction : kDirections) {
+            for (int r = row_begin; r < row_end; ++r) {
+                for (int w = 0; w < words_per_row; ++w) {
+                    uint64_t matches = ~uint64_t{0};
+                    for (int k = 0; k < length && matches != 0; ++k) {
+                        matches &= planes.plane(word[k]).window(r + k * direction[0], 64 * w + k * direction[1]);
+                    }
+                    count += std::popcount(matches);
+                }
+            }
+        }
+        return count;
+    }
+
+    std::vector<const uint64_t*> rows(length);
+    std::vector<int> word_offsets(length);
+    std::vector<int> shifts(length);
+    int64_t count = 0;
+    for (const auto& direction : kDirections) {
+        const int dr = direction[0];
+        const int dc = direction[1];
+        for (int k = 0; k < length; ++k) {
+            word_offsets[k] = (k * dc) >> 6;
+            shifts[k] = (k * dc) & 63;
+        }
+        for (int r = row_begin; r < row_end; ++r) {
+            for (int k = 0; k < length; ++k) {
+                rows[k] = planes.plane(word[k]).rowWords(r + k * dr) + word_offsets[k];
+            }
+            for (int w = 0; w < words_per_row; ++w) {
+                uint64_t matches = ~uint64_t{0};
+                for (int k = 0; k < length; ++k) {
+                    matches &= BitPlane::funnelShift(rows[k][w], rows[k][w + 1], shifts[k]);
+                }
+                count += std::popcount(matches);
+            }
+        }
+    }
+    return count;
+}
+
+inline int64_t countWordMatches(const LetterPlanes& planes, std::string_view word) {
+    return countWordMatches(planes, word, 0, planes.rows());
+}
+
+enum class StencilSymmetry {
+    None,                    // the pattern as written
+    Rotations,               // plus its 90, 180 and 270 degree turns; square stencils only
+    RotationsAndReflections  // plus the mirror image of each of those
+};
+
+// A small H x W pattern for countStencilMatches(), written row by row in one
+// string; '.' matches any cell.
+//
+//     static constexpr Stencil<3, 3> kShape{"M.S"
+//                                           ".A."
+//                                           "M.S"};
+template <int H, int W>
+struct Stencil {
+    static constexpr char kWildcard = '.';
+    static constexpr int height = H;
+    static constexpr int width = W;
+
+    std::array<char, H * W> cells{};
+
+    constexpr Stencil() = default;
+
+    constexpr explicit Stencil(const char (&text)[H * W + 1]) {
+        for (int i = 0; i < H * W; ++i) {
+            cells[i] = text[i];
+        }
+    }
+
+    constexpr char at(int row, int col) const { return cells[row * W + col]; }
+
+    constexpr bool operator==(const Stencil&) const = default;
+
+    // Quarter turn clockwise; only square stencils keep their type
+    constexpr Stencil rotated() const {
+        static_assert(H == W, "only square stencils can be rotated");
+        Stencil turned;
+        for (int r = 0; r < H; ++r) {
+            for (int c = 0; c < W; ++c) {
+                turned.cells[c * W + (W - 1 - r)] = at(r, c);
+            }
+        }
+        return turned;
+    }
+
+    // Left-right mirror image
+    constexpr Stencil reflected() const {
+        Stencil mirrored;
+        for (int r = 0; r < H; ++r) {
+            for (int c = 0; c < W; ++c) {
+                mirrored.cells[r * W + (W - 1 - c)] = at(r, c);
+            }
+        }
+        return mirrored;
+    }
+
+    constexpr int fixedCells() const {
+        int count = 0;
+        for (char cell : cells) {
+            count += cell != kWildcard;
+        }
+        return count;
+    }
+};
+
+// The distinct orientations of a stencil under a symmetry
+template <int H, int W>
+struct StencilVariants {
+    std::array<Stencil<H, W>, 8> items{};
+    int count = 0;
+
+    constexpr void add(const Stencil<H, W>& stencil) {
+        for (int i = 0; i < count; ++i) {
+            if (items[i] == stencil) {
+                return;
+            }
+        }
+        items[count++] = stencil;
+    }
+};
+
+template <int H, int W>
+constexpr StencilVariants<H, W> stencilVariants(const Stencil<H, W>& stencil, StencilSymmetry symmetry) {
+    StencilVariants<H, W> variants;
+    variants.add(stencil);
+    if constexpr (H == W) {
+        if (symmetry != StencilSymmetry::None) {
+            Stencil<H, W> turned = stencil;
+            for (int i = 0; i < 3; ++i) {
+                turned = turned.rotated();
+                variants.add(turned);
+            }
+        }
+    } else if (symmetry != StencilSymmetry::None) {
+        // A quarter turn changes the shape, so it cannot be listed here
+        throw std::invalid_argument("only square stencils can be rotated");
+    }
+    if (symmetry == StencilSymmetry::RotationsAndReflections) {
+        int rotations = variants.count;
+        for (int i = 0; i < rotations; ++i) {
+            variants.add(variants.items[i].reflected());
+        }
+    }
+    return variants;
+}
+
+// Counts placements of `Pattern`, in any orientation `Symmetry` allows,
+// whose top-left corner lies in rows [row_begin, row_end) and which fit
+// inside the grid. A placement matching several orientations counts once.
+// The pattern is a template argument, so each stencil gets its own kernel
+// with the cell offsets and letters folded in: per 64 anchors, the planes
+// of every fixed cell are ANDed at the cell's offset, and the orientations
+// ORed together.
+template <auto Pattern, StencilSymmetry Symmetry = StencilSymmetry::None>
+int64_t countStencilMatches(const LetterPlanes& planes, int row_begin, int row_end) {
+    constexpr int H = Pattern.height;
+    constexpr int W = Pattern.width;
+    static_assert(W <= 64, "stencils are matched within one word of padding");
+    static_assert(Symmetry == StencilSymmetry::None || H == W,
+                  "rotations need a square stencil; match each orientation separately");
+    constexpr auto kVariants = stencilVariants(Pattern, Symmetry);
+    constexpr int kCells = Pattern.fixedCells();
+
+    struct Cell {
+        int row;
+        int col;
+        const BitPlane* plane;
+        const uint64_t* words;
+    };
+    std::array<std::array<Cell, kCells>, kVariants.count> cells;
+    for (int v = 0; v < kVariants.count; ++v) {
+        int n = 0;
+        for (int r = 0; r < H; ++r) {
+            for (int c = 0; c < W; ++c) {
+                char letter = kVariants.items[v].at(r, c);
+                if (letter != Pattern.kWildcard) {
+                    cells[v][n++] = {r, c, &planes.plane(letter), nullptr};
+                }
+            }
+        }
+    }
+
+    const int words_per_row = planes.wordsPerRow();
+    const int anchors_per_row = planes.cols() - W + 1;
+    row_begin = std::max(row_begin, 0);
+    row_end = std::min(row_end, planes.rows() - H + 1);
+    int64_t count = 0;
+    for (int r = row_begin; r < row_end; ++r) {
+        for (auto& variant : cells) {
+            for (auto& cell : variant) {
+                cell.words = cell.plane->rowWords(r + cell.row);
+            }
+        }
+        for (int w = 0; w < words_per_row; ++w) {
+            int anchors = anchors_per_row - 64 * w;
+            if (anchors <= 0) {
+                break;
+            }
+            uint64_t valid = anchors >= 64 ? ~uint64_t{0} : (uint64_t{1} << anchors) - 1;
+            uint64_t any = 0;
+            for (const auto& variant : cells) {
+                uint64_t matches = valid;
+                for (const auto& cell : variant) {
+                    matches &= BitPlane::funnelShift(cell.words[w], cell.words[w + 1], cell.col);
+                }
+                any |= matches;
+            }
+            count += std::popcount(any);
+        }
+    }
+    return count;
+}
+
+#endif // ADVENT_BIT_GRID_H
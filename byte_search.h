@@ -0,0 +1,86 @@
+#ifndef ADVENT_BYTE_SEARCH_H
+#define ADVENT_BYTE_SEARCH_H
+
+#include <cstdint>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define ADVENT_BYTE_SEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+// Finds the first byte equal to either of two values, for scanners that only
+// need to look closely at a few candidate offsets in mostly-noise input. The
+// widest implementation the CPU supports is picked once at run time: AVX2 (64
+// bytes a step), SSE2 (16) or plain scalar code.
+namespace byte_search {
+
+inline const char* findEitherScalar(const char* p, const char* end, char a, char b) {
+    while (p != end && *p != a && *p != b) {
+        ++p;
+    }
+    return p;
+}
+
+#ifdef ADVENT_BYTE_SEARCH_X86
+
+__attribute__((target("sse2")))
+inline const char* findEitherSse2(const char* p, const char* end, char a, char b) {
+    const __m128i want_a = _mm_set1_epi8(a);
+    const __m128i want_b = _mm_set1_epi8(b);
+    while (end - p >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i hits = _mm_or_si128(_mm_cmpeq_epi8(chunk, want_a), _mm_cmpeq_epi8(chunk, want_b));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hits));
+        if (mask != 0) {
+            return p + __builtin_ctz(mask);
+        }
+        p += 16;
+    }
+    return findEitherScalar(p, end, a, b);
+}
+
+__attribute__((target("avx2")))
+inline const char* findEitherAvx2(const char* p, const char* end, char a, char b) {
+    const __m256i want_a = _mm256_set1_epi8(a);
+    const __m256i want_b = _mm256_set1_epi8(b);
+    while (end - p >= 64) {
+        __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+        __m256i low_hits = _mm256_or_si256(_mm256_cmpeq_epi8(low, want_a), _mm256_cmpeq_epi8(low, want_b));
+        __m256i high_hits = _mm256_or_si256(_mm256_cmpeq_epi8(high, want_a), _mm256_cmpeq_epi8(high, want_b));
+        uint64_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(low_hits)) |
+                        static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(high_hits))) << 32;
+        if (mask != 0) {
+            return p + __builtin_ctzll(mask);
+        }
+        p += 64;
+    }
+    return findEitherSse2(p, end, a, b);
+}
+
+#endif // ADVENT_BYTE_SEARCH_X86
+
+using FindEither = const char* (*)(const char*, const char*, char, char);
+
+inline FindEither selectFindEither() {
+#ifdef ADVENT_BYTE_SEARCH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return findEitherAvx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return findEitherSse2;
+    }
+#endif
+    return findEitherScalar;
+}
+
+} // namespace byte_search
+
+// First byte in [p, end) equal to `a` or `b`, or `end` if there is none.
+inline const char* findEitherByte(const char* p, const char* end, char a, char b) {
+    static const byte_search::FindEither find = byte_search::selectFindEither();
+    return find(p, end, a, b);
+}
+
+#endif // ADVENT_BYTE_SEARCH_H
@@ -0,0 +1,1827 @@
+#ifndef ADVENT_DAYS_H
+#define ADVENT_DAYS_H
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "advent_day.h"
+#include "aho_corasick.h"
+#include "bit_grid.h"
+#include "byte_search.h"
+#include "external_sort.h"
+#include "grid2d.h"
+#include "guard_patrol.h"
+#include "int_scanner.h"
+#include "radix_sort.h"
+#include "trace.h"
+
+class One : public AdventDay {
+public:
+    explicit One(const std::string& input_file_path) : AdventDay(input_file_path) {}
+
+    void parseInput() override {
+        if (!loadInput()) {
+            throw std::runtime_error("Error: Could not open the file " + input_file_path);
+        }
+
+        left.clear();
+        right.clear();
+        left_runs.clear();
+        right_runs.clear();
+
+        // Under a memory budget the columns are sorted a chunk at a time and
+        // spilled; the two chunks plus the sort's scratch take 12 bytes a pair.
+        // Every chunk becomes one run per column, and the merge reads each
+        // left run once and each right run twice with at least
+        // kMinMergeBuffer ints apiece, so chunks are also kept large enough
+        // for those buffers to fit the budget. A budget too small for both
+        // lets the chunks grow past it rather than the merge.
+        size_t chunk_pairs = std::numeric_limits<size_t>::max();
+        std::vector<int> scratch;
+        if (memory_budget) {
+            // The shortest pair line is "1 1\n", so this bounds the pair count
+            // without a pass over the input
+            const size_t max_pairs = input_buffer.size() / 4 + 1;
+            const size_t reader_bytes = 3 * kMinMergeBuffer * sizeof(int);
+            const size_t min_chunk = (max_pairs * reader_bytes + memory_budget - 1) / memory_budget;
+            chunk_pairs = std::max({memory_budget / 12, min_chunk, size_t{1}});
+            // Reserved up front so growth never holds two copies at once
+            const size_t reserved = std::min(chunk_pairs, max_pairs);
+            left.reserve(reserved);
+            right.reserve(reserved);
+            scratch.reserve(reserved);
+        }
+        IntScanner scanner(input_buffer.view());
+        while (!scanner.atEnd()) {
+            int col_one, col_two;
+            if (scanner.next(col_one) && scanner.next(col_two)) {
+                left.push_back(col_one);
+                right.push_back(col_two);
+                if (left.size() == chunk_pairs) {
+                    spillChunk(scratch);
+                }
+            }
+            scanner.nextLine();
+        }
+
+        if (left_runs.empty()) {
+            radixSort(left, scratch);
+            radixSort(right, scratch);
+        } else {
+            spillChunk(scratch);
+            left = {};
+            right = {};
+        }
+    }
+
+    DayResult solve() override {
+        DayResult result;
+        if (!left_runs.empty()) {
+            auto [distance, similarity] = mergeSpilledRuns();
+            result.part_one = distance;
+            result.part_two = similarity;
+            return result;
+        }
+        result.part_one = calculateTotalDistance();
+        result.part_two = calculateSimilarityScore();
+        return result;
+    }
+
+private:
+    static constexpr size_t kMinMergeBuffer = 1024;
+
+    // Both columns, sorted ascending. Empty when the input was spilled.
+    std::vector<int> left;
+    std::vector<int> right;
+    // Sorted runs of each column, when the input outgrew the memory budget
+    SortedRuns left_runs;
+    SortedRuns right_runs;
+
+    void spillChunk(std::vector<int>& scratch) {
+        radixSort(left, scratch);
+        radixSort(right, scratch);
+        left_runs.append(left);
+        right_runs.append(right);
+        left.clear();
+        right.clear();
+    }
+
+    // Both answers from one pass over the merged runs. The right column is
+    // merged twice: one cursor pairs up with the left by rank for the
+    // distance, the other joins with it by value for the similarity score.
+    std::pair<int64_t, int64_t> mergeSpilledRuns() const {
+        ADVENT_TRACE_SCOPE("One::mergeSpilledRuns");
+        size_t readers = left_runs.runs().size() + 2 * right_runs.runs().size();
+        size_t buffer_size = std::max(kMinMergeBuffer, memory_budget / sizeof(int) / readers);
+        RunMerger lefts(left_runs, buffer_size);
+        RunMerger by_rank(right_runs, buffer_size);
+        RunMerger by_value(right_runs, buffer_size);
+
+        int64_t distance = 0, similarity = 0;
+        int64_t matches = 0;
+        bool have_previous = false;
+        int previous = 0;
+        while (!lefts.atEnd()) {
+            int value = lefts.front();
+            lefts.pop();
+
+            if (!by_rank.atEnd()) {
+                distance += std::abs(static_cast<int64_t>(value) - by_rank.front());
+                by_rank.pop();
+            }
+
+            if (!have_previous || value != previous) {
+                while (!by_value.atEnd() && by_value.front() < value) {
+                    by_value.pop();
+                }
+                matches = 0;
+                while (!by_value.atEnd() && by_value.front() == value) {
+                    ++matches;
+                    by_value.pop();
+                }
+                previous = value;
+                have_previous = true;
+            }
+            similarity += value * matches;
+        }
+        return {distance, similarity};
+    }
+
+    int64_t calculateTotalDistance() const {
+        ADVENT_TRACE_SCOPE("One::calculateTotalDistance");
+        int64_t total = 0;
+        size_t pairs = std::min(left.size(), right.size());
+        for (size_t i = 0; i < pairs; ++i) {
+            total += std::abs(static_cast<int64_t>(left[i]) - right[i]);
+        }
+        return total;
+    }
+
+    // Merge-join of the sorted columns: a value seen a times on the left and
+    // b times on the right contributes value * a * b.
+    int64_t calculateSimilarityScore() const {
+        ADVENT_TRACE_SCOPE("One::calculateSimilarityScore");
+        int64_t total = 0;
+        size_t i = 0, j = 0;
+        while (i < left.size() && j < right.size()) {
+            if (left[i] < right[j]) {
+                ++i;
+            } else if (right[j] < left[i]) {
+                ++j;
+            } else {
+                int value = left[i];
+                int64_t left_count = 0, right_count = 0;
+                for (; i < left.size() && left[i] == value; ++i) {
+                    ++left_count;
+                }
+                for (; j < right.size() && right[j] == value; ++j) {
+                    ++right_count;
+                }
+                total += value * left_count * right_count;
+            }
+        }
+        return total;
+    }
+};
+
+class Two : public AdventDay {
+    public:
+        explicit Two(const std::string& input_file_path) : AdventDay(input_file_path) {}
+        void parseInput() override {
+            if (!loadInput()) {
+                throw std::runtime_error("Error: Could not open the file " + input_file_path);
+            }
+
+            // Large inputs are cut at line boundaries into blocks that are
+            // parsed, and later validated, independently on the worker pool.
+            std::vector<std::string_view> pieces = splitAtNewlines(
+                input_buffer.view(), threadCount() * kBlocksPerThread, kMinBlockBytes);
+            blocks.resize(pieces.size());
+            if (threadCount() <= 1 || pieces.size() <= 1) {
+                for (size_t i = 0; i < pieces.size(); ++i) {
+                    parseBlock(pieces[i], blocks[i]);
+                }
+                return;
+            }
+
+            std::vector<std::future<void>> pending;
+            pending.reserve(pieces.size());
+            for (size_t i = 0; i < pieces.size(); ++i) {
+                pending.push_back(workers().submit([this, &pieces, i] { parseBlock(pieces[i], blocks[i]); }));
+            }
+            for (auto& done : pending) {
+                done.get();
+            }
+        }
+
+        DayResult solve() override {
+            ADVENT_TRACE_SCOPE("Two::countSafeReports");
+            SafeCounts total;
+            if (threadCount() <= 1 || blocks.size() <= 1) {
+                std::vector<uint8_t> steps;
+                for (const auto& block : blocks) {
+                    total += countSafe(block, steps);
+                }
+            } else {
+                std::vector<std::future<SafeCounts>> pending;
+                pending.reserve(blocks.size());
+                for (const auto& block : blocks) {
+                    pending.push_back(workers().submit([&block] {
+                        std::vector<uint8_t> steps;
+                        return countSafe(block, steps);
+                    }));
+                }
+                for (auto& counts : pending) {
+                    total += counts.get();
+                }
+            }
+
+            DayResult result;
+            result.part_one = total.safe;
+            result.part_two = total.dampened_safe;
+            return result;
+        }
+
+    private:
+        static constexpr uint8_t kIncreasing = 1;
+        static constexpr uint8_t kDecreasing = 2;
+        static constexpr size_t kBlocksPerThread = 4;
+        static constexpr size_t kMinBlockBytes = 1 << 20;
+
+        // Reports in CSR form: report r is levels[offsets[r] .. offsets[r + 1])
+        struct ReportBlock {
+            std::vector<int> levels;
+            std::vector<size_t> offsets;
+        };
+
+        struct SafeCounts {
+            int64_t safe = 0;
+            int64_t dampened_safe = 0;
+
+            SafeCounts& operator+=(const SafeCounts& other) {
+                safe += other.safe;
+                dampened_safe += other.dampened_safe;
+                return *this;
+            }
+        };
+
+        std::vector<ReportBlock> blocks;
+
+        static void parseBlock(std::string_view text, ReportBlock& block) {
+            block.levels.clear();
+            block.offsets.assign(1, 0);
+            IntScanner scanner(text);
+            while (!scanner.atEnd()) {
+                int val;
+                while (scanner.next(val)) {
+                    block.levels.push_back(val);
+                }
+                block.offsets.push_back(block.levels.size());
+                scanner.nextLine();
+            }
+        }
+
+        // `steps` is scratch space, reused between calls
+        static SafeCounts countSafe(const ReportBlock& block, std::vector<uint8_t>& steps) {
+            const std::vector<int>& levels = block.levels;
+            const std::vector<size_t>& offsets = block.offsets;
+
+            // Step flags for every adjacent pair of levels in one flat pass,
+            // reports back to back. Pairs straddling two reports are computed
+            // too but never read; skipping them would break vectorisation.
+            const size_t pair_count = levels.empty() ? 0 : levels.size() - 1;
+            steps.resize(pair_count);
+            for (size_t i = 0; i < pair_count; ++i) {
+                steps[i] = stepFlags(levels[i], levels[i + 1]);
+            }
+
+            SafeCounts counts;
+            for (size_t report = 0; report + 1 < offsets.size(); ++report) {
+                size_t begin = offsets[report];
+                size_t end = offsets[report + 1];
+                uint8_t all = kIncreasing | kDecreasing;
+                for (size_t i = begin; i + 1 < end; ++i) {
+                    all &= steps[i];
+                }
+                if (all != 0) {
+                    ++counts.safe;
+                    ++counts.dampened_safe;
+                } else if (safeWithOneRemoval(levels, steps, begin, end, kIncreasing) ||
+                           safeWithOneRemoval(levels, steps, begin, end, kDecreasing)) {
+                    ++counts.dampened_safe;
+                }
+            }
+            return counts;
+        }
+
+        // Which directions the step from `from` to `to` is safe in
+        static uint8_t stepFlags(int from, int to) {
+            int64_t diff = static_cast<int64_t>(to) - from;
+            return static_cast<uint8_t>((diff >= 1 && diff <= 3) * kIncreasing |
+                                        (diff >= -3 && diff <= -1) * kDecreasing);
+        }
+
+        // Whether dropping one level makes levels[begin, end) safe in
+        // `direction`. Only the two levels of the first bad step are worth
+        // trying: any other removal leaves that step in place.
+        static bool safeWithOneRemoval(const std::vector<int>& levels, const std::vector<uint8_t>& steps,
+                                       size_t begin, size_t end, uint8_t direction) {
+            size_t bad = begin;
+            while (bad + 1 < end && (steps[bad] & direction)) {
+                ++bad;
+            }
+            if (bad + 1 >= end) {
+                return true;
+            }
+            return safeWithout(levels, steps, begin, end, bad, direction) ||
+                   safeWithout(levels, steps, begin, end, bad + 1, direction);
+        }
+
+        // Whether levels[begin, end) minus levels[skip] is safe in
+        // `direction`, given every step before skip - 1 already is.
+        static bool safeWithout(const std::vector<int>& levels, const std::vector<uint8_t>& steps,
+                                size_t begin, size_t end, size_t skip, uint8_t direction) {
+            if (skip > begin && skip + 1 < end &&
+                !(stepFlags(levels[skip - 1], levels[skip + 1]) & direction)) {
+                return false;
+            }
+            for (size_t i = skip + 1; i + 1 < end; ++i) {
+                if (!(steps[i] & direction)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+};
+
+class Three: public AdventDay {
+    public:
+    explicit Three(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {
+        totals = {};
+        if (!loadInput()) {
+            throw std::runtime_error("Error: Could not open the file " + input_file_path);
+        }
+
+        std::string_view text = input_buffer.view();
+        size_t chunk_count = std::min<size_t>(threadCount() * kChunksPerThread, text.size() / kMinChunkBytes);
+        if (threadCount() <= 1 || chunk_count <= 1) {
+            totals = scanInstructions(text.data(), text.data() + text.size(), text.data() + text.size());
+            return;
+        }
+
+        // Chunks are cut at arbitrary bytes. A token belongs to the chunk it
+        // starts in and may be read past the chunk's end; the bytes after its
+        // first hold no 'm' or 'd', so the next chunk never starts a match
+        // inside it. Each chunk's summary covers both entry states, and
+        // folding them in order gives the sequential answer.
+        const char* end = text.data() + text.size();
+        size_t chunk_bytes = text.size() / chunk_count + 1;
+        std::vector<std::future<ChunkSummary>> pending;
+        pending.reserve(chunk_count);
+        for (const char* start = text.data(); start < end; start += std::min<size_t>(chunk_bytes, end - start)) {
+            const char* stop = start + std::min<size_t>(chunk_bytes, end - start);
+            pending.push_back(workers().submit([start, stop, end] { return scanInstructions(start, stop, end); }));
+        }
+        for (auto& chunk : pending) {
+            totals = totals.then(chunk.get());
+        }
+    }
+    DayResult solve() override {
+        DayResult result;
+        result.part_one = totals.all;
+        result.part_two = totals.if_enabled;
+        return result;
+    }
+    private:
+    static constexpr size_t kChunksPerThread = 4;
+    static constexpr size_t kMinChunkBytes = 1 << 20;
+
+    // What a stretch of the input contributes, for either state do()/don't()
+    // left it in on entry. Combining two summaries with then() is
+    // associative, so chunks can be scanned in any order and folded after.
+    struct ChunkSummary {
+        enum Exit { Unchanged, Enabled, Disabled };
+
+        int64_t all = 0;          // every mul
+        int64_t if_enabled = 0;   // muls that count when entered enabled
+        int64_t if_disabled = 0;  // ... and when entered disabled
+        Exit exit = Unchanged;    // state left by the last do()/don't(), if any
+
+        ChunkSummary then(const ChunkSummary& next) const {
+            ChunkSummary combined;
+            combined.all = all + next.all;
+            combined.if_enabled = if_enabled + next.sumFrom(exit != Disabled);
+            combined.if_disabled = if_disabled + next.sumFrom(exit == Enabled);
+            combined.exit = next.exit == Unchanged ? exit : next.exit;
+            return combined;
+        }
+
+        int64_t sumFrom(bool enabled) const { return enabled ? if_enabled : if_disabled; }
+    };
+
+    struct Instruction {
+        enum Kind { Mul, Do, Dont } kind;
+        int64_t product;
+    };
+
+    ChunkSummary totals;
+
+    // One pass over [begin, stop) for both parts and both entry states; a
+    // token starting before `stop` may run on up to `end`. A vectorised
+    // search skips the noise between candidate 'm'/'d' bytes, and the exact
+    // match only runs at those offsets. Every token starts with 'm' or 'd'
+    // and holds no other 'm' or 'd', so when a partial match fails no other
+    // token can have started inside it: resuming one byte later finds
+    // exactly the matches a leftmost regex search would.
+    static ChunkSummary scanInstructions(const char* begin, const char* stop, const char* end) {
+        ADVENT_TRACE_SCOPE("Three::scanInstructions");
+        ChunkSummary found;
+        bool enabled_from_enabled = true;
+        bool enabled_from_disabled = false;
+        const char* p = begin;
+        while ((p = findEitherByte(p, stop, 'm', 'd')) != stop) {
+            Instruction instruction;
+            const char* next = matchInstruction(p, end, instruction);
+            if (!next) {
+                ++p;
+                continue;
+            }
+            if (instruction.kind == Instruction::Mul) {
+                found.all += instruction.product;
+                found.if_enabled += enabled_from_enabled ? instruction.product : 0;
+                found.if_disabled += enabled_from_disabled ? instruction.product : 0;
+            } else {
+                bool enabled = instruction.kind == Instruction::Do;
+                enabled_from_enabled = enabled_from_disabled = enabled;
+                found.exit = enabled ? ChunkSummary::Enabled : ChunkSummary::Disabled;
+            }
+            // A token straddling `stop` ends the chunk
+            p = std::min(next, stop);
+        }
+        return found;
+    }
+
+    // Matches mul(\d+,\d+), do() or don't() at `p`. Returns the end of the
+    // token, or nullptr if none starts here. Numbers of any length are
+    // accepted, as \d+ would; their products wrap rather than trap.
+    static const char* matchInstruction(const char* p, const char* end, Instruction& out) {
+        auto literal = [&](std::string_view expected) {
+            if (static_cast<size_t>(end - p) < expected.size() ||
+                std::memcmp(p, expected.data(), expected.size()) != 0) {
+                return false;
+            }
+            p += expected.size();
+            return true;
+        };
+        auto number = [&](uint64_t& value) {
+            const char* start = p;
+            value = 0;
+            while (p != end && static_cast<unsigned char>(*p - '0') < 10) {
+                value = value * 10 + static_cast<uint64_t>(*p - '0');
+                ++p;
+            }
+            return p != start;
+        };
+
+        if (*p == 'm') {
+            uint64_t a, b;
+            if (literal("mul(") && number(a) && literal(",") && number(b) && literal(")")) {
+                out = {Instruction::Mul, static_cast<int64_t>(a * b)};
+                return p;
+            }
+            return nullptr;
+        }
+        if (literal("do()")) {
+            out = {Instruction::Do, 0};
+            return p;
+        }
+        if (literal("don't()")) {
+            out = {Instruction::Dont, 0};
+            return p;
+        }
+        return nullptr;
+    }
+};
+
+class Four: public AdventDay {
+public:
+    explicit Four(const std::string& input_file_path) : AdventDay(input_file_path) {}
+
+    void parseInput() override {
+        grid.clear();
+        planes = {};
+        if (!loadInput()) {
+            throw std::runtime_error("Error: Could not open the file " + input_file_path);
+        }
+
+        std::vector<std::string_view> lines;
+        for (std::string_view line : input_buffer.lines()) {
+            if (line.empty()) break;
+            lines.push_back(line);
+        }
+        grid = Grid2D<char>::fromLines(lines, [](char c) { return c; });
+        planes = LetterPlanes(grid, kWord);
+    }
+
+    DayResult solve() override {
+        DayResult result;
+        if (grid.empty()) {
+            return result;
+        }
+        result.part_one = countXMAS();
+        result.part_two = countXMASPatterns();
+        if (!word_list.empty()) {
+            std::vector<int64_t> counts = countWords(word_list);
+            for (size_t i = 0; i < word_list.size(); ++i) {
+                result.diagnostics.push_back({"Word " + word_list[i], counts[i]});
+            }
+        }
+        return result;
+    }
+
+    // Occurrences of each word read in any of the eight directions, counted
+    // the way part one counts XMAS. One Aho-Corasick pass over every row,
+    // column, diagonal and anti-diagonal finds all the words at once; the
+    // automaton also holds each word reversed, which stands in for reading
+    // every line the other way.
+    std::vector<int64_t> countWords(const std::vector<std::string>& words) const {
+        ADVENT_TRACE_SCOPE("Four::countWords");
+        std::vector<std::string> patterns = words;
+        for (const auto& word : words) {
+            patterns.emplace_back(word.rbegin(), word.rend());
+        }
+        AhoCorasick automaton(patterns);
+        std::vector<int64_t> pattern_counts(patterns.size(), 0);
+
+        auto scanLine = [&](int row, int col, int dr, int dc) {
+            int state = AhoCorasick::start();
+            for (; grid.inBounds(row, col); row += dr, col += dc) {
+                state = automaton.next(state, grid(row, col));
+                automaton.forEachMatch(state, [&](size_t pattern) { ++pattern_counts[pattern]; });
+            }
+        };
+        const int R = grid.rows();
+        const int C = grid.cols();
+        for (int r = 0; r < R; ++r) {
+            scanLine(r, 0, 0, 1);
+        }
+        for (int c = 0; c < C; ++c) {
+            scanLine(0, c, 1, 0);
+        }
+        // Diagonals start on the top row or the left column, anti-diagonals
+        // on the top row or the right column
+        for (int c = 0; c < C; ++c) {
+            scanLine(0, c, 1, 1);
+            scanLine(0, c, 1, -1);
+        }
+        for (int r = 1; r < R; ++r) {
+            scanLine(r, 0, 1, 1);
+            scanLine(r, C - 1, 1, -1);
+        }
+
+        std::vector<int64_t> counts(words.size());
+        for (size_t i = 0; i < words.size(); ++i) {
+            counts[i] = pattern_counts[i] + pattern_counts[words.size() + i];
+        }
+        return counts;
+    }
+
+    private:
+    static constexpr std::string_view kWord = "XMAS";
+    // Two MAS crossing on their A; the other three turns cover the rest
+    static constexpr Stencil<3, 3> kXmasShape{"M.S"
+                                              ".A."
+                                              "M.S"};
+
+    Grid2D<char> grid;
+    LetterPlanes planes;
+
+    // Rows per band below which splitting the grid costs more than it saves
+    static constexpr int kMinBandRows = 256;
+
+    // Both parts count matches by anchor row, so large grids are cut into
+    // bands scanned on the worker pool. Matches reaching past a band's edges
+    // read the neighbouring rows straight from the shared bit planes.
+    template <typename Count>
+    int64_t countByBands(Count&& count) {
+        std::vector<RowBand> bands = splitRowBands(planes.rows(), static_cast<int>(threadCount()) * 2,
+                                                   kMinBandRows);
+        if (threadCount() <= 1 || bands.size() <= 1) {
+            return count(RowBand{0, planes.rows()});
+        }
+        return sumRowBands(workers(), bands, count);
+    }
+
+    int64_t countXMAS() {
+        ADVENT_TRACE_SCOPE("Four::countXMAS");
+        return countByBands([this](const RowBand& band) {
+            return countWordMatches(planes, kWord, band.begin, band.end);
+        });
+    }
+
+    int64_t countXMASPatterns() {
+        ADVENT_TRACE_SCOPE("Four::countXMASPatterns");
+        return countByBands([this](const RowBand& band) {
+            return countStencilMatches<kXmasShape, StencilSymmetry::Rotations>(planes, band.begin, band.end);
+        });
+    }
+};
+
+class Five : public AdventDay {
+public:
+    explicit Five(const std::string& input_file_path)
+        : AdventDay(input_file_path) {}
+
+    void parseInput() override {
+        grid.clear();
+        start_dir = -1;
+        if (!loadInput()) {
+            throw std::runtime_error("Error: Could not open the file " + input_file_path);
+        }
+
+        std::vector<std::string_view> lines;
+        for (std::string_view line : input_buffer.lines()) {
+            if (line.empty()) {
+                continue;
+            }
+            lines.push_back(line);
+        }
+        grid = Grid2D<char>::fromLines(lines, [](char c) { return c; });
+        obstacles = ObstacleIndex(grid);
+
+        for (int i = 0; i < grid.rows() && start_dir < 0; ++i) {
+            for (int j = 0; j < grid.cols(); ++j) {
+                start_dir = guardDirection(grid(i, j));
+                if (start_dir >= 0) {
+                    start_row = i;
+                    start_col = j;
+                    break;
+                }
+            }
+        }
+    }
+
+    DayResult solve() override {
+        DayResult result;
+        if (grid.empty()) {
+            return result;
+        }
+        result.part_one = simulate_guard_patrol();
+        return result;
+    }
+
+private:
+    Grid2D<char> grid;
+    ObstacleIndex obstacles;
+    int start_row = 0;
+    int start_col = 0;
+    int start_dir = -1;
+
+    // Walks whole straight stretches at a time, marking them in a bitset
+    int64_t simulate_guard_patrol() const {
+        ADVENT_TRACE_SCOPE("Five::simulate_guard_patrol");
+        if (start_dir < 0) {
+            return 0;
+        }
+
+        CellBitset visited(grid.rows(), grid.cols());
+        int row = start_row, col = start_col, dir = start_dir;
+        // Each of the 4 * cells (cell, direction) states starts at most one
+        // stretch on a patrol that ends, so more than that means a loop
+        const int64_t max_stretches = 4 * static_cast<int64_t>(grid.rows()) * grid.cols() + 1;
+        for (int64_t stretch = 0;; ++stretch) {
+            if (stretch > max_stretches) {
+                throw std::runtime_error("Error: the guard never leaves the map");
+            }
+            GuardStop stop = obstacles.slide(row, col, dir);
+            visited.markWalk(row, col, stop);
+            if (stop.exits) {
+                break;
+            }
+            row = stop.row;
+            col = stop.col;
+            dir = turnRight(dir);
+        }
+        return visited.count();
+    }
+};
+
+class Six : public AdventDay {
+public:
+    explicit Six(const std::string& input_file_path)
+        : AdventDay(input_file_path) {}
+
+    void parseInput() override {
+        grid_.clear();
+        startDir_ = -1;
+
+        if (!loadInput()) {
+            throw std::runtime_error("Error: Could not open the file " + input_file_path);
+        }
+
+        std::vector<std::string_view> lines;
+        for (std::string_view line : input_buffer.lines()) {
+            if (line.empty()) {
+                continue;
+            }
+            lines.push_back(line);
+        }
+        grid_ = Grid2D<char>::fromLines(lines, [](char c) { return c; });
+
+        rows_ = grid_.rows();
+        cols_ = grid_.cols();
+        obstacles_ = ObstacleIndex(grid_);
+
+        for (int i = 0; i < rows_ && startDir_ < 0; ++i) {
+            for (int j = 0; j < cols_; ++j) {
+                startDir_ = guardDirection(grid_(i, j));
+                if (startDir_ >= 0) {
+                    startPos_ = {i, j};
+                    break;
+                }
+            }
+        }
+    }
+
+    DayResult solve() override {
+        DayResult result;
+        if (grid_.empty() || startDir_ < 0) {
+            result.part_two = 0;
+            return result;
+        }
+
+        result.part_two = findValidLoops();
+        return result;
+    }
+
+private:
+    struct GuardState {
+        int row;
+        int col;
+        int dir;
+    };
+
+    // A cell to block, with the guard's state one step before reaching it
+    struct Candidate {
+        GuardState from;
+        int row;
+        int col;
+    };
+
+    static constexpr size_t kCandidatesPerTask = 64;
+
+    Grid2D<char> grid_;
+    ObstacleIndex obstacles_;
+    int rows_ = 0;
+    int cols_ = 0;
+    std::pair<int,int> startPos_{-1, -1};
+    int startDir_ = -1;
+
+    // Walks the guard from `from` with one extra obstacle at (blockRow,
+    // blockCol), a whole stretch at a time. A loop means running into the same
+    // obstacle in the same direction twice, so only turns are stamped.
+    bool causesLoop(GuardState from, int blockRow, int blockCol, GuardStateStamps& seen) const {
+        ADVENT_TRACE_SCOPE("Six::causesLoop");
+        seen.nextGeneration();
+        ObstacleOverlay overlay(obstacles_, blockRow, blockCol);
+        int row = from.row, col = from.col, dir = from.dir;
+        while (true) {
+            GuardStop stop = overlay.slide(row, col, dir);
+            if (stop.exits) {
+                return false;
+            }
+            if (!seen.visit(stop.obstacle, dir)) {
+                return true;
+            }
+            row = stop.row;
+            col = stop.col;
+            dir = turnRight(dir);
+        }
+    }
+
+    // Only cells on the guard's own path can change its route. Each one is
+    // tested once, from the state just before the guard first reaches it:
+    // everything up to there is unaffected by the new obstacle.
+    std::vector<Candidate> findCandidates() const {
+        std::vector<Candidate> candidates;
+        CellBitset tried(rows_, cols_);
+        tried.insert(startPos_.first, startPos_.second);
+
+        int row = startPos_.first, col = startPos_.second, dir = startDir_;
+        const int64_t max_steps = 4 * static_cast<int64_t>(rows_) * cols_ + 1;
+        for (int64_t step = 0;; ++step) {
+            if (step > max_steps) {
+                throw std::runtime_error("Error: the guard never leaves the map");
+            }
+            int nextRow = row + kGuardRowStep[dir];
+            int nextCol = col + kGuardColStep[dir];
+            if (nextRow < 0 || nextRow >= rows_ || nextCol < 0 || nextCol >= cols_) {
+                break;
+            }
+            if (grid_(nextRow, nextCol) == '#') {
+                dir = turnRight(dir);
+                continue;
+            }
+            if (tried.insert(nextRow, nextCol)) {
+                candidates.push_back({{row, col, dir}, nextRow, nextCol});
+            }
+            row = nextRow;
+            col = nextCol;
+        }
+        return candidates;
+    }
+
+    int64_t countLoops(const Candidate* first, const Candidate* last, GuardStateStamps& seen) const {
+        int64_t loops = 0;
+        for (const Candidate* candidate = first; candidate != last; ++candidate) {
+            if (causesLoop(candidate->from, candidate->row, candidate->col, seen)) {
+                ++loops;
+            }
+        }
+        return loops;
+    }
+
+    // Loop checks vary a lot in length, so candidates go out in small chunks
+    // and idle workers steal what is left. Each worker keeps its own stamps,
+    // 16 bytes per obstacle, made on the first chunk it takes.
+    int64_t findValidLoops() {
+        ADVENT_TRACE_SCOPE("Six::findValidLoops");
+        std::vector<Candidate> candidates = findCandidates();
+        if (threadCount() <= 1 || candidates.size() <= kCandidatesPerTask) {
+            GuardStateStamps seen(obstacles_.count() + 1);
+            return countLoops(candidates.data(), candidates.data() + candidates.size(), seen);
+        }
+
+        ThreadPool& pool = workers();
+        std::vector<std::unique_ptr<GuardStateStamps>> scratch(pool.size());
+        std::vector<std::future<int64_t>> pending;
+        for (size_t begin = 0; begin < candidates.size(); begin += kCandidatesPerTask) {
+            const Candidate* first = candidates.data() + begin;
+            const Candidate* last = candidates.data() + std::min(candidates.size(), begin + kCandidatesPerTask);
+            pending.push_back(pool.submit([this, &pool, &scratch, first, last] {
+                auto& seen = scratch[pool.workerIndex()];
+                if (!seen) {
+                    seen = std::make_unique<GuardStateStamps>(obstacles_.count() + 1);
+                }
+                return countLoops(first, last, *seen);
+            }));
+        }
+        int64_t loops = 0;
+        for (auto& result : pending) {
+            loops += result.get();
+        }
+        return loops;
+    }
+};
+
+class Seven : public AdventDay {
+    struct Equation {
+        int64_t target;
+        std::vector<int64_t> numbers;
+    };
+
+    std::vector<Equation> equations;
+
+    int64_t concatenate(int64_t a, int64_t b) {
+        std::string str_b = std::to_string(b);
+        return a * static_cast<int64_t>(pow(10, str_b.length())) + b;
+    }
+
+    int64_t evaluate(const std::vector<int64_t>& numbers, const std::vector<char>& operators) {
+        if (numbers.empty()) return 0;
+        if (numbers.size() == 1) return numbers[0];
+
+        int64_t result = numbers[0];
+        for (size_t i = 0; i < operators.size(); i++) {
+            if (operators[i] == '+') {
+                result += numbers[i + 1];
+            } else if (operators[i] == '*') {
+                result *= numbers[i + 1];
+            } else if (operators[i] == '|') {
+                result = concatenate(result, numbers[i + 1]);
+            }
+        }
+        return result;
+    }
+
+    bool can_match(const std::vector<int64_t>& numbers, int64_t target) {
+        ADVENT_TRACE_SCOPE("Seven::can_match");
+        int ops_needed = numbers.size() - 1;
+        int64_t total_combinations = static_cast<int64_t>(pow(3, ops_needed));
+
+        for (int64_t i = 0; i < total_combinations; i++) {
+            std::vector<char> operators(ops_needed);
+            int64_t temp = i;
+
+            for (int j = 0; j < ops_needed; j++) {
+                int op = temp % 3;
+                operators[j] = (op == 0) ? '+' : (op == 1) ? '*' : '|';
+                temp /= 3;
+            }
+
+            if (evaluate(numbers, operators) == target) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+public:
+    explicit Seven(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {
+        equations.clear();
+        if (!loadInput()) {
+            throw std::runtime_error("Error: Could not open the file " + input_file_path);
+        }
+
+        // Each line is "target: n1 n2 ..."; the scanner skips the colon
+        IntScanner scanner(input_buffer.view());
+        for (; !scanner.atEnd(); scanner.nextLine()) {
+            int64_t target;
+            if (!scanner.next(target)) continue;
+
+            std::vector<int64_t> numbers;
+            int64_t num;
+            while (scanner.next(num)) {
+                numbers.push_back(num);
+            }
+            equations.push_back({target, std::move(numbers)});
+        }
+    }
+    DayResult solve() override {
+        ADVENT_TRACE_SCOPE("Seven::calibrate");
+        int64_t sum = 0;
+        for (const auto& equation : equations) {
+            if (can_match(equation.numbers, equation.target)) {
+                sum += equation.target;
+            }
+        }
+        DayResult result;
+        result.part_two = sum;
+        return result;
+    }
+};
+
+class Eight : public AdventDay {
+private:
+    struct Point {
+        int x, y;
+
+        Point(int x, int y) : x(x), y(y) {}
+
+        bool isCollinearWith(const Point& p2, const Point& p3) const {
+            // Using cross product to check collinearity
+            return (int64_t)(p2.y - y) * (p3.x - p2.x) ==
+                   (int64_t)(p2.x - x) * (p3.y - p2.y);
+        }
+
+        std::string toString() const {
+            return std::to_string(x) + "," + std::to_string(y);
+        }
+    };
+
+    Grid2D<char> map;
+
+    std::pmr::set<std::string> findAntinodes(const std::vector<Point>& antennas) {
+        std::pmr::set<std::string> antinodes(arena());
+        if (antennas.size() < 2) return antinodes;
+
+        for (const Point& antenna : antennas) {
+            antinodes.insert(antenna.toString());
+        }
+
+        for (int x = 0; x < map.rows(); x++) {
+            for (int y = 0; y < map.cols(); y++) {
+                Point p(x, y);
+
+                for (size_t i = 0; i < antennas.size(); i++) {
+                    for (size_t j = i + 1; j < antennas.size(); j++) {
+                        if (p.isCollinearWith(antennas[i], antennas[j])) {
+                            antinodes.insert(p.toString());
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        return antinodes;
+    }
+
+    size_t partTwo() {
+        ADVENT_TRACE_SCOPE("Eight::partTwo");
+        std::pmr::set<std::string> allAntinodes(arena());
+        std::map<char, std::vector<Point>> antennaMap;
+
+        for (int i = 0; i < map.rows(); i++) {
+            for (int j = 0; j < map.cols(); j++) {
+                char freq = map(i, j);
+                if (freq != '.') {
+                    antennaMap[freq].emplace_back(i, j);
+                }
+            }
+        }
+
+        for (const auto& [freq, sameFreqAntennas] : antennaMap) {
+            std::pmr::set<std::string> frequencyAntinodes = findAntinodes(sameFreqAntennas);
+            allAntinodes.insert(frequencyAntinodes.begin(), frequencyAntinodes.end());
+        }
+
+        return allAntinodes.size();
+    }
+
+public:
+    explicit Eight(const std::string& input_file_path) : AdventDay(input_file_path) {}
+
+    void parseInput() override {
+        map.clear();
+        if (!loadInput()) {
+            throw std::runtime_error("Error: Could not open the file " + input_file_path);
+        }
+
+        std::vector<std::string_view> lines;
+        for (std::string_view line : input_buffer.lines()) {
+            if (!line.empty()) {
+                lines.push_back(line);
+            }
+        }
+        map = Grid2D<char>::fromLines(lines, [](char c) { return c; }, 0, '.');
+    }
+
+    DayResult solve() override {
+        DayResult result;
+        result.part_two = static_cast<int64_t>(partTwo());
+        return result;
+    }
+};
+
+class Nine : public AdventDay {
+private:
+    std::vector<std::string> input;
+    long fileIdx;
+
+    long sumBlocksAndIds(const std::vector<std::string>& blocks) {
+        long total = 0;
+        for (size_t i = 0; i < blocks.size(); i++) {
+            if (blocks[i] != ".") {
+                total += i * std::stol(blocks[i]);
+            }
+        }
+        return total;
+    }
+
+    std::vector<std::string> moveBlocksV1(const std::vector<std::string>& blocks) {
+        std::vector<std::string> copiedBlocks = blocks;
+        bool movesMade;
+
+        do {
+            movesMade = false;
+            int rightmostFile = copiedBlocks.size() - 1;
+
+            while (rightmostFile >= 0 && copiedBlocks[rightmostFile] == ".") {
+                rightmostFile--;
+            }
+
+            if (rightmostFile >= 0) {
+                int leftmostSpace = 0;
+                while (leftmostSpace < rightmostFile && copiedBlocks[leftmostSpace] != ".") {
+                    leftmostSpace++;
+                }
+
+                if (leftmostSpace < rightmostFile && copiedBlocks[leftmostSpace] == ".") {
+                    std::string fileId = copiedBlocks[rightmostFile];
+                    copiedBlocks[leftmostSpace] = fileId;
+                    copiedBlocks[rightmostFile] = ".";
+                    movesMade = true;
+                }
+            }
+        } while (movesMade);
+
+        return copiedBlocks;
+    }
+
+    std::vector<std::string> moveBlocksV2(const std::vector<std::string>& blocks) {
+        std::vector<std::string> copiedBlocks = blocks;
+        std::map<int, std::pair<int, int>> fileInfo;
+        int maxId = -1;
+
+        for (size_t i = 0; i < copiedBlocks.size(); i++) {
+            const std::string& block = copiedBlocks[i];
+            if (block != ".") {
+                int id = std::stoi(block);
+                maxId = std::max(maxId, id);
+                if (fileInfo.find(id) == fileInfo.end()) {
+                    fileInfo[id] = {i, 1};
+                } else {
+                    fileInfo[id].second++;
+                }
+            }
+        }
+
+        for (int id = maxId; id >= 0; id--) {
+            auto it = fileInfo.find(id);
+            if (it == fileInfo.end()) continue;
+
+            int fileStart = it->second.first;
+            int fileSize = it->second.second;
+
+            int consecutiveSpace = 0;
+            int spaceStart = -1;
+
+            for (int i = 0; i < fileStart; i++) {
+                if (copiedBlocks[i] == ".") {
+                    if (spaceStart == -1) spaceStart = i;
+                    consecutiveSpace++;
+                    if (consecutiveSpace >= fileSize) break;
+                } else {
+                    consecutiveSpace = 0;
+                    spaceStart = -1;
+                }
+            }
+
+            if (consecutiveSpace >= fileSize) {
+                std::string idStr = std::to_string(id);
+                for (int i = 0; i < fileSize; i++) {
+                    copiedBlocks[spaceStart + i] = idStr;
+                    copiedBlocks[fileStart + i] = ".";
+                }
+            }
+        }
+
+        return copiedBlocks;
+    }
+
+    long partOne() {
+        ADVENT_TRACE_SCOPE("Nine::partOne");
+        std::vector<std::string> movedBlocks = moveBlocksV1(input);
+        return sumBlocksAndIds(movedBlocks);
+    }
+
+    long partTwo() {
+        ADVENT_TRACE_SCOPE("Nine::partTwo");
+        std::vector<std::string> movedBlocks = moveBlocksV2(input);
+        return sumBlocksAndIds(movedBlocks);
+    }
+
+public:
+    explicit Nine(const std::string& input_file_path) : AdventDay(input_file_path) {}
+
+    void parseInput() override {
+        input.clear();
+        if (!loadInput()) {
+            throw std::runtime_error("Error: Could not open the file " + input_file_path);
+        }
+        int fileId = 0;
+        bool isFile = true;
+
+        for (char c : input_buffer.view()) {
+            int size = c - '0';
+            if (size >= 0) {
+                if (isFile) {
+                    for (int i = 0; i < size; i++) {
+                        input.push_back(std::to_string(fileId));
+                    }
+                    fileId++;
+                } else {
+                    for (int i = 0; i < size; i++) {
+                        input.push_back(".");
+                    }
+                }
+                isFile = !isFile;
+            }
+        }
+        fileIdx = fileId - 1;
+    }
+
+    DayResult solve() override {
+        DayResult result;
+        result.part_one = partOne();
+        result.part_two = partTwo();
+        return result;
+    }
+};
+
+class Ten : public AdventDay {
+public:
+    explicit Ten(const std::string& input_file_path)
+        : AdventDay(input_file_path){}
+
+    void parseInput() override
+    {
+        input_.clear();
+        if (!loadInput()) {
+            throw std::runtime_error("Error: Could not open the file " + input_file_path);
+        }
+
+        std::vector<std::string_view> lines;
+        for (std::string_view line : input_buffer.lines()) {
+            if (!line.empty()) {
+                lines.push_back(line);
+            }
+        }
+        input_ = Grid2D<int>::fromLines(lines, [](char character) { return character - '0'; },
+                                        1, NO_HEIGHT);
+    }
+
+    DayResult solve() override
+    {
+        DayResult result;
+        if (input_.empty()) {
+            return result;
+        }
+        memo_.assign(input_.rows(), input_.cols(), NOT_COUNTED);
+
+        result.part_one = partOne();
+        result.part_two = partTwo();
+        return result;
+    }
+
+private:
+    static constexpr int DIRECTIONS[4][2] = {
+        { -1,  0 },  // up
+        {  0,  1 },  // right
+        {  0, -1 },  // left
+        {  1,  0 }   // down
+    };
+
+    // Height of the one-cell border around the map; no step ever climbs onto it
+    static constexpr int NO_HEIGHT = std::numeric_limits<int>::min();
+    static constexpr int NOT_COUNTED = -1;
+
+    Grid2D<int> input_;
+
+    Grid2D<int> memo_;
+
+    bool isValidNeighbor(int r, int c, int requiredHeight) const
+    {
+        return input_(r, c) == (requiredHeight + 1);
+    }
+
+    void dfs(int row, int col,
+             std::pmr::set<std::pair<int,int>>& visited,
+             std::pmr::set<std::pair<int,int>>& peaks)
+    {
+        std::pair<int,int> currentPos = { row, col };
+
+        if (visited.find(currentPos) != visited.end()) {
+            return;
+        }
+        visited.insert(currentPos);
+
+        int cellHeight = input_(row, col);
+        if (cellHeight == 9) {
+            peaks.insert(currentPos);
+            return;
+        }
+
+        for (auto& direction : DIRECTIONS) {
+            int newRow = row + direction[0];
+            int newCol = col + direction[1];
+            if (isValidNeighbor(newRow, newCol, cellHeight)) {
+                dfs(newRow, newCol, visited, peaks);
+            }
+        }
+    }
+
+    std::pmr::set<std::pair<int,int>> findReachablePeaks(int startRow, int startCol)
+    {
+        std::pmr::set<std::pair<int,int>> visited(arena());
+        std::pmr::set<std::pair<int,int>> peaks(arena());
+
+        int startHeight = input_(startRow, startCol);
+        if (startHeight != 0) {
+            return peaks;
+        }
+
+        dfs(startRow, startCol, visited, peaks);
+        return peaks;
+    }
+
+    int partOne()
+    {
+        ADVENT_TRACE_SCOPE("Ten::partOne");
+        int totalScore = 0;
+        for (int row = 0; row < input_.rows(); ++row) {
+            for (int col = 0; col < input_.cols(); ++col) {
+                if (input_(row, col) == 0) {
+                    std::pmr::set<std::pair<int,int>> peaks = findReachablePeaks(row, col);
+                    totalScore += static_cast<int>(peaks.size());
+                }
+            }
+        }
+        return totalScore;
+    }
+
+    int countAllPaths(int row, int col)
+    {
+        if (memo_(row, col) != NOT_COUNTED) {
+            return memo_(row, col);
+        }
+
+        int currHeight = input_(row, col);
+        if (currHeight == 9) {
+            memo_(row, col) = 1;
+            return 1;
+        }
+
+        int totalPathsFromHere = 0;
+        for (auto& direction : DIRECTIONS) {
+            int newRow = row + direction[0];
+            int newCol = col + direction[1];
+
+            if (isValidNeighbor(newRow, newCol, currHeight)) {
+                totalPathsFromHere += countAllPaths(newRow, newCol);
+            }
+        }
+
+        memo_(row, col) = totalPathsFromHere;
+        return totalPathsFromHere;
+    }
+
+    int partTwo()
+    {
+        ADVENT_TRACE_SCOPE("Ten::partTwo");
+        int totalRating = 0;
+        for (int row = 0; row < input_.rows(); ++row) {
+            for (int col = 0; col < input_.cols(); ++col) {
+                if (input_(row, col) == 0) {
+                    totalRating += countAllPaths(row, col);
+                }
+            }
+        }
+        return totalRating;
+    }
+};
+
+
+class Eleven : public AdventDay {
+public:
+    explicit Eleven(const std::string& input_file_path)
+        : AdventDay(input_file_path)
+    {
+    }
+
+    void parseInput() override
+    {
+        std::map<std::string, long long> distribution;
+
+        if (!loadInput()) {
+            throw std::runtime_error("Error: Could not open the file " + input_file_path);
+        }
+
+        for (std::string_view token : input_buffer.tokens()) {
+            distribution[std::string(token)] += 1;
+        }
+
+        input_ = distribution;
+    }
+
+    DayResult solve() override
+    {
+        DayResult result;
+        // Part one also records the stone count every five blinks
+        result.part_one = simulateBlinks(25, &result.diagnostics);
+        result.part_two = simulateBlinks(75, nullptr);
+        return result;
+    }
+
+private:
+    std::map<std::string, long long> input_;
+
+    // Stone counts keyed by the stone's digits. Keys live on the arena and
+    // are looked up by string_view, so a blink allocates only for stones it
+    // has not produced before.
+    using StoneCounts = std::pmr::map<std::pmr::string, long long, std::less<>>;
+
+    // Product digits, reused across stones
+    std::string product_;
+
+    static void addStones(StoneCounts& dist, std::string_view stone, long long count)
+    {
+        auto it = dist.lower_bound(stone);
+        if (it != dist.end() && it->first == stone) {
+            it->second += count;
+        } else {
+            dist.emplace_hint(it, stone, count);
+        }
+    }
+
+    // Adds the 1 or 2 stones that `stone` turns into
+    void transformStone(std::string_view stone, long long count, StoneCounts& newDist)
+    {
+        if (stone == "0") {
+            addStones(newDist, "1", count);
+            return;
+        }
+
+        if (stone.size() % 2 == 0) {
+            size_t mid = stone.size() / 2;
+            addStones(newDist, stone.substr(0, mid), count);
+            addStones(newDist, stone.substr(mid), count);
+            return;
+        }
+
+        multiplyStringByInt(stone, 2024, product_);
+        addStones(newDist, product_, count);
+    }
+
+    static void multiplyStringByInt(std::string_view s, int multiplier, std::string& result)
+    {
+        result.clear();
+        if (s == "0" || multiplier == 0) {
+            result.push_back('0');
+            return;
+        }
+
+        int carry = 0;
+        for (int i = static_cast<int>(s.size()) - 1; i >= 0; i--) {
+            int digit = s[i] - '0';
+            long long prod = static_cast<long long>(digit) * multiplier + carry;
+            int newDigit = static_cast<int>(prod % 10);
+            carry        = static_cast<int>(prod / 10);
+            result.push_back(static_cast<char>('0' + newDigit));
+        }
+
+        while (carry > 0) {
+            int newDigit = carry % 10;
+            result.push_back(static_cast<char>('0' + newDigit));
+            carry /= 10;
+        }
+
+        std::reverse(result.begin(), result.end());
+    }
+
+    long long simulateBlinks(int numBlinks, std::vector<Diagnostic>* debug)
+    {
+        ADVENT_TRACE_SCOPE("Eleven::simulateBlinks");
+        StoneCounts dist(arena());
+        for (const auto& [stoneValue, count] : input_) {
+            addStones(dist, stoneValue, count);
+        }
+
+        for (int i = 0; i < numBlinks; i++) {
+            StoneCounts newDist(arena());
+            for (const auto& [stoneValue, count] : dist) {
+                transformStone(stoneValue, count, newDist);
+            }
+
+            dist = std::move(newDist);
+            ADVENT_TRACE_COUNTER("Eleven distinct stones", dist.size());
+
+            if (debug && ((i + 1) % 5 == 0)) {
+                long long totalStones = 0;
+                for (auto& kv : dist) {
+                    totalStones += kv.second;
+                }
+                debug->push_back({"Stones after " + std::to_string(i + 1) + " blinks", totalStones});
+            }
+        }
+
+        long long total = 0;
+        for (auto& kv : dist) {
+            total += kv.second;
+        }
+        return total;
+    }
+};
+
+class Twelve : public AdventDay {
+public:
+    explicit Twelve(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class Thirteen : public AdventDay {
+public:
+    explicit Thirteen(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class Fourteen : public AdventDay {
+public:
+    explicit Fourteen(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class Fifteen : public AdventDay {
+public:
+    explicit Fifteen(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class Sixteen : public AdventDay {
+public:
+    explicit Sixteen(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class Seventeen : public AdventDay {
+public:
+    explicit Seventeen(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class Eighteen : public AdventDay {
+public:
+    explicit Eighteen(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class Nineteen : public AdventDay {
+public:
+    explicit Nineteen(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class Twenty : public AdventDay {
+private:
+    struct Position {
+        int row, col;
+
+        Position(int r, int c) : row(r), col(c) {}
+
+        bool operator==(const Position& other) const {
+            return row == other.row && col == other.col;
+        }
+    };
+
+    struct PositionHash {
+        std::size_t operator()(const Position& pos) const {
+            return std::hash<int>()(pos.row) ^ (std::hash<int>()(pos.col) << 1);
+        }
+    };
+
+    struct CheatKey {
+        Position start, end;
+
+        CheatKey(const Position& s, const Position& e) : start(s), end(e) {}
+
+        bool operator==(const CheatKey& other) const {
+            return start == other.start && end == other.end;
+        }
+    };
+
+    struct CheatKeyHash {
+        std::size_t operator()(const CheatKey& key) const {
+            PositionHash posHash;
+            return posHash(key.start) ^ (posHash(key.end) << 1);
+        }
+    };
+
+    // Cells the race never reached; also fills the border of every DistanceMap
+    static constexpr int UNREACHED = -1;
+
+    // Walled in by a one-cell border of '#', so the BFS needs no bounds tests
+    Grid2D<char> grid;
+    // (-1, -1) until the input's 'S' or 'E' is found
+    Position start{-1, -1};
+    Position end{-1, -1};
+    int rows{0}, cols{0};
+
+    using DistanceMap = Grid2D<int>;
+    using CheatSet = std::pmr::unordered_set<CheatKey, CheatKeyHash>;
+
+    void parseInput() override {
+        grid.clear();
+        start = Position(-1, -1);
+        end = Position(-1, -1);
+        rows = 0;
+        cols = 0;
+        if (!loadInput()) {
+            throw std::runtime_error("Error: Could not open the file " + input_file_path);
+        }
+        std::vector<std::string_view> lines;
+        for (std::string_view line : input_buffer.lines()) {
+            lines.push_back(line);
+        }
+        if (lines.empty()) {
+            return;
+        }
+        grid = Grid2D<char>::fromLines(lines, [](char c) { return c; }, 1, '#');
+        rows = grid.rows();
+        cols = grid.cols();
+
+        for (int i = 0; i < rows; ++i) {
+            for (int j = 0; j < cols; ++j) {
+                if (grid(i, j) == 'S') {
+                    start = Position(i, j);
+                } else if (grid(i, j) == 'E') {
+                    end = Position(i, j);
+                }
+            }
+        }
+    }
+
+    DistanceMap computeDistances(const Position& pos) const {
+        ADVENT_TRACE_SCOPE("Twenty::computeDistances");
+        DistanceMap distances(rows, cols, UNREACHED, 1, UNREACHED);
+        std::queue<size_t> q;
+
+        size_t origin = grid.index(pos.row, pos.col);
+        distances[origin] = 0;
+        q.push(origin);
+
+        const auto dirs = grid.neighbourOffsets();
+
+        while (!q.empty()) {
+            size_t current = q.front();
+            q.pop();
+
+            for (std::ptrdiff_t step : dirs) {
+                size_t next = current + step;
+
+                if (grid[next] != '#' && distances[next] == UNREACHED) {
+                    distances[next] = distances[current] + 1;
+                    q.push(next);
+                }
+            }
+        }
+
+        return distances;
+    }
+
+    int findCheats(const DistanceMap& startDists, const DistanceMap& endDists,
+                   int normalDist, int maxCheatLen, int minSaving) const {
+        ADVENT_TRACE_SCOPE("Twenty::findCheats");
+        CheatSet uniqueCheats(arena());
+
+        for (int startRow = 0; startRow < rows; ++startRow) {
+            for (int startCol = 0; startCol < cols; ++startCol) {
+                int distToStart = startDists(startRow, startCol);
+                if (distToStart == UNREACHED) continue;
+
+                Position startPos(startRow, startCol);
+                for (int r = std::max(0, startPos.row - maxCheatLen);
+                     r < std::min(rows, startPos.row + maxCheatLen + 1); ++r) {
+                    for (int c = std::max(0, startPos.col - maxCheatLen);
+                         c < std::min(cols, startPos.col + maxCheatLen + 1); ++c) {
+
+                        int distToEnd = endDists(r, c);
+                        if (distToEnd == UNREACHED) continue;
+
+                        int manhattanDist = std::abs(r - startPos.row) +
+                                          std::abs(c - startPos.col);
+                        if (manhattanDist > maxCheatLen) continue;
+
+                        int totalDist = distToStart + manhattanDist + distToEnd;
+                        if (normalDist - totalDist >= minSaving) {
+                            uniqueCheats.insert(CheatKey(startPos, Position(r, c)));
+                        }
+                    }
+                }
+            }
+        }
+
+        return uniqueCheats.size();
+    }
+
+public:
+    explicit Twenty(const std::string& inputFilePath)
+        : AdventDay(inputFilePath) {}
+
+    DayResult solve() override {
+        DayResult result;
+        if (grid.empty()) {
+            return result;
+        }
+        if (start.row < 0 || end.row < 0) {
+            result.diagnostics.push_back({"No path exists!", std::nullopt});
+            return result;
+        }
+        DistanceMap startDistances = computeDistances(start);
+        DistanceMap endDistances = computeDistances(end);
+
+        int normalDist = startDistances(end.row, end.col);
+        if (normalDist == UNREACHED) {
+            result.diagnostics.push_back({"No path exists!", std::nullopt});
+            return result;
+        }
+
+        int part1 = findCheats(startDistances, endDistances, normalDist, 2, 100);
+
+        int part2 = findCheats(startDistances, endDistances, normalDist, 20, 100);
+
+        result.part_one = part1;
+        result.part_two = part2;
+        return result;
+    }
+};
+
+class TwentyOne: public AdventDay {
+public:
+    explicit TwentyOne(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class TwentyTwo : public AdventDay {
+public:
+    explicit TwentyTwo(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class TwentyThree : public AdventDay {
+public:
+    explicit TwentyThree(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class TwentyFour : public AdventDay {
+public:
+    explicit TwentyFour(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+class TwentyFive : public AdventDay {
+public:
+    explicit TwentyFive(const std::string& input_file_path) : AdventDay(input_file_path) {}
+    void parseInput() override {}
+    DayResult solve() override { return {}; }
+};
+
+struct DayInfo {
+    int number;
+    const char* default_input_path;
+    std::unique_ptr<AdventDay> (*create)(const std::string& input_file_path);
+};
+
+template <typename Day>
+std::unique_ptr<AdventDay> makeDay(const std::string& input_file_path) {
+    return std::make_unique<Day>(input_file_path);
+}
+
+// Every solved day, in order, with the input it reads by default.
+inline const std::vector<DayInfo>& implementedDays() {
+    static const std::vector<DayInfo> days = {
+        {1, "../day-one.txt", makeDay<One>},
+        {2, "../day-two.txt", makeDay<Two>},
+        {3, "../day-three.txt", makeDay<Three>},
+        {4, "../day-four.txt", makeDay<Four>},
+        {5, "../day-five.txt", makeDay<Five>},
+        {6, "../day-six.txt", makeDay<Six>},
+        {7, "../day-seven.txt", makeDay<Seven>},
+        {8, "../day-eight.txt", makeDay<Eight>},
+        {9, "../day-nine.txt", makeDay<Nine>},
+        {10, "../day-ten.txt", makeDay<Ten>},
+        {11, "../day-eleven.txt", makeDay<Eleven>},
+
+        // unimplemented
+        // {12, "../day-12.txt", makeDay<Twelve>},
+        // {13, "../day-13.txt", makeDay<Thirteen>},
+        // {14, "../day-14.txt", makeDay<Fourteen>},
+        // {15, "../day-15.txt", makeDay<Fifteen>},
+        // {16, "../day-16.txt", makeDay<Sixteen>},
+        // {17, "../day-17.txt", makeDay<Seventeen>},
+        // {18, "../day-18.txt", makeDay<Eighteen>},
+        // {19, "../day-19.txt", makeDay<Nineteen>},
+
+        {20, "../day-20.txt", makeDay<Twenty>},
+
+        // unimplemented
+        // {21, "../day-21.txt", makeDay<TwentyOne>},
+        // {22, "../day-22.txt", makeDay<TwentyTwo>},
+        // {23, "../day-23.txt", makeDay<TwentyThree>},
+        // {24, "../day-24.txt", makeDay<TwentyFour>},
+        // {25, "../day-25.txt", makeDay<TwentyFive>},
+    };
+    return days;
+}
+
+inline const DayInfo* findDay(int number) {
+    for (const auto& day : implementedDays()) {
+        if (day.number == number) {
+            return &day;
+        }
+    }
+    return nullptr;
+}
+
+#endif // ADVENT_DAYS_H
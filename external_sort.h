@@ -0,0 +1,146 @@
+#ifndef ADVENT_EXTERNAL_SORT_H
+#define ADVENT_EXTERNAL_SORT_H
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+// Sorted runs of ints spilled to an anonymous temporary file, for data that
+// does not fit in memory. Runs are appended one after another; RunMerger
+// reads them back as a single sorted stream.
+class SortedRuns {
+public:
+    struct Run {
+        off_t offset;
+        size_t count;
+    };
+
+    // `sorted` must already be in ascending order
+    void append(const std::vector<int>& sorted) {
+        if (sorted.empty()) {
+            return;
+        }
+        if (!file) {
+            file.reset(std::tmpfile());
+            if (!file) {
+                throw std::runtime_error(std::string("Error: could not create a spill file: ") + std::strerror(errno));
+            }
+        }
+        if (std::fwrite(sorted.data(), sizeof(int), sorted.size(), file.get()) != sorted.size() ||
+            std::fflush(file.get()) != 0) {
+            throw std::runtime_error(std::string("Error: could not write a spill file: ") + std::strerror(errno));
+        }
+        runs_.push_back({end, sorted.size()});
+        end += static_cast<off_t>(sorted.size() * sizeof(int));
+        total += sorted.size();
+    }
+
+    void clear() {
+        file.reset();
+        runs_.clear();
+        end = 0;
+        total = 0;
+    }
+
+    bool empty() const { return runs_.empty(); }
+    size_t size() const { return total; }
+    const std::vector<Run>& runs() const { return runs_; }
+
+    // Positional reads, so several mergers can share the file
+    void read(off_t offset, int* destination, size_t count) const {
+        size_t bytes = count * sizeof(int);
+        char* out = reinterpret_cast<char*>(destination);
+        while (bytes > 0) {
+            ssize_t got = ::pread(::fileno(file.get()), out, bytes, offset);
+            if (got <= 0) {
+                throw std::runtime_error("Error: could not read back a spill file");
+            }
+            out += got;
+            offset += got;
+            bytes -= static_cast<size_t>(got);
+        }
+    }
+
+private:
+    struct Closer {
+        void operator()(std::FILE* f) const { std::fclose(f); }
+    };
+
+    std::unique_ptr<std::FILE, Closer> file;
+    std::vector<Run> runs_;
+    off_t end = 0;
+    size_t total = 0;
+};
+
+// K-way merge over every run of a SortedRuns, buffering `buffer_size`
+// values per run. Memory use is runs * buffer_size ints whatever the total.
+class RunMerger {
+public:
+    RunMerger(const SortedRuns& source, size_t buffer_size)
+        : source(source), buffer_size(std::max<size_t>(buffer_size, 1)) {
+        cursors.resize(source.runs().size());
+        for (size_t i = 0; i < cursors.size(); ++i) {
+            cursors[i].next_offset = source.runs()[i].offset;
+            cursors[i].remaining = source.runs()[i].count;
+            if (refill(cursors[i])) {
+                heap.push({cursors[i].buffer[0], i});
+            }
+        }
+    }
+
+    bool atEnd() const { return heap.empty(); }
+
+    // Smallest value not yet popped; only valid when !atEnd()
+    int front() const { return heap.top().first; }
+
+    void pop() {
+        size_t run = heap.top().second;
+        heap.pop();
+        Cursor& cursor = cursors[run];
+        if (++cursor.position == cursor.buffer.size() && !refill(cursor)) {
+            return;
+        }
+        heap.push({cursor.buffer[cursor.position], run});
+    }
+
+private:
+    struct Cursor {
+        std::vector<int> buffer;
+        size_t position = 0;
+        off_t next_offset = 0;
+        size_t remaining = 0;
+    };
+
+    const SortedRuns& source;
+    size_t buffer_size;
+    std::vector<Cursor> cursors;
+    std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>,
+                        std::greater<>> heap;
+
+    bool refill(Cursor& cursor) {
+        if (cursor.remaining == 0) {
+            cursor.buffer = {};
+            return false;
+        }
+        size_t count = std::min(buffer_size, cursor.remaining);
+        cursor.buffer.resize(count);
+        source.read(cursor.next_offset, cursor.buffer.data(), count);
+        cursor.next_offset += static_cast<off_t>(count * sizeof(int));
+        cursor.remaining -= count;
+        cursor.position = 0;
+        return true;
+    }
+};
+
+#endif // ADVENT_EXTERNAL_SORT_H
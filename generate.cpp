@@ -0,0 +1,505 @@
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Seeded pseudo-random source. Only std::mt19937_64 itself is used because
+// its output is fixed by the standard, unlike the std:: distributions, so a
+// given seed produces the same input on every platform.
+class Random {
+public:
+    explicit Random(uint64_t seed) : engine(seed) {}
+
+    // Uniform value in [0, bound)
+    uint64_t below(uint64_t bound) {
+        return static_cast<uint64_t>((static_cast<unsigned __int128>(engine()) * bound) >> 64);
+    }
+
+    // Uniform value in [low, high]
+    int64_t between(int64_t low, int64_t high) {
+        return low + static_cast<int64_t>(below(static_cast<uint64_t>(high - low) + 1));
+    }
+
+    // True with probability numerator / denominator
+    bool chance(uint64_t numerator, uint64_t denominator) {
+        return below(denominator) < numerator;
+    }
+
+private:
+    std::mt19937_64 engine;
+};
+
+// Buffers generated text and writes it out in large blocks, so multi-GB
+// inputs stream to disk without being held in memory.
+class Output {
+public:
+    explicit Output(std::ostream& stream) : stream(stream) {
+        buffer.reserve(kBlockSize + 4096);
+    }
+
+    ~Output() { flush(); }
+
+    void put(char c) {
+        buffer.push_back(c);
+        maybeFlush();
+    }
+
+    void put(std::string_view text) {
+        buffer.append(text);
+        maybeFlush();
+    }
+
+    void number(int64_t value) {
+        put(std::string_view(std::to_string(value)));
+    }
+
+    void flush() {
+        stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+        stream.flush();
+    }
+
+private:
+    static constexpr size_t kBlockSize = 1 << 20;
+
+    std::ostream& stream;
+    std::string buffer;
+
+    void maybeFlush() {
+        if (buffer.size() >= kBlockSize) {
+            flush();
+        }
+    }
+};
+
+// Day 1: `scale` rows of two location IDs. IDs are drawn from a range that
+// shrinks with the row count so the similarity score sees repeats.
+void generateOne(uint64_t scale, Random& random, Output& out) {
+    int64_t range = std::max<int64_t>(10, static_cast<int64_t>(scale) * 2);
+    range = std::min<int64_t>(range, 1'000'000'000);
+    for (uint64_t i = 0; i < scale; ++i) {
+        out.number(random.between(1, range));
+        out.put("   ");
+        out.number(random.between(1, range));
+        out.put('\n');
+    }
+}
+
+// Day 2: `scale` reports of 5-8 levels. Most are monotonic with safe steps;
+// some get one or two bad levels so the dampener has work to do.
+void generateTwo(uint64_t scale, Random& random, Output& out) {
+    for (uint64_t i = 0; i < scale; ++i) {
+        int length = static_cast<int>(random.between(5, 8));
+        int direction = random.chance(1, 2) ? 1 : -1;
+        int64_t level = random.between(20, 80);
+        int faults = random.chance(1, 2) ? 0 : static_cast<int>(random.between(1, 2));
+        for (int j = 0; j < length; ++j) {
+            if (j > 0) {
+                out.put(' ');
+                int64_t step = direction * random.between(1, 3);
+                if (faults > 0 && random.chance(1, static_cast<uint64_t>(length))) {
+                    step = random.chance(1, 2) ? 0 : -direction * random.between(1, 5);
+                    --faults;
+                }
+                level += step;
+            }
+            out.number(level);
+        }
+        out.put('\n');
+    }
+}
+
+// Day 3: roughly `scale` bytes of corrupted memory, mixing valid mul(a,b),
+// do() and don't() instructions with near misses and noise.
+void generateThree(uint64_t scale, Random& random, Output& out) {
+    static const std::string_view kNoise = "!@#$%^&*()[]{}<>+-?/;:' ,mudontwhyselectfrom";
+    static const std::string_view kNearMisses[] = {
+        "mul(", "mul[3,7]", "mul ( 2 , 4 )", "mul(32,64]", "do(", "don't", "mul(4*", "?(12,34)",
+    };
+
+    uint64_t written = 0;
+    uint64_t line_length = 0;
+    while (written < scale) {
+        std::string token;
+        uint64_t kind = random.below(20);
+        if (kind < 3) {
+            token = "mul(" + std::to_string(random.between(1, 999)) + "," +
+                    std::to_string(random.between(1, 999)) + ")";
+        } else if (kind == 3) {
+            token = random.chance(1, 2) ? "do()" : "don't()";
+        } else if (kind == 4) {
+            token = kNearMisses[random.below(std::size(kNearMisses))];
+        } else {
+            token = kNoise[random.below(kNoise.size())];
+        }
+        out.put(std::string_view(token));
+        written += token.size();
+        line_length += token.size();
+        if (line_length >= 3000 && written < scale) {
+            out.put('\n');
+            ++written;
+            line_length = 0;
+        }
+    }
+    out.put('\n');
+}
+
+// Day 4: a `scale` x `scale` grid of X, M, A and S.
+void generateFour(uint64_t scale, Random& random, Output& out) {
+    static const char kLetters[] = {'X', 'M', 'A', 'S'};
+    std::string row(scale, '.');
+    for (uint64_t r = 0; r < scale; ++r) {
+        for (uint64_t c = 0; c < scale; ++c) {
+            row[c] = kLetters[random.below(4)];
+        }
+        out.put(std::string_view(row));
+        out.put('\n');
+    }
+}
+
+// Follows the guard on `grid` and reports whether it walks off the map.
+bool guardEscapes(const std::vector<std::string>& grid, uint64_t start_row, uint64_t start_col) {
+    static const int kDeltas[4][2] = {{-1, 0}, {0, 1}, {1, 0}, {0, -1}};
+    const int64_t rows = static_cast<int64_t>(grid.size());
+    const int64_t cols = static_cast<int64_t>(grid[0].size());
+    std::vector<uint8_t> seen(static_cast<size_t>(rows * cols), 0);
+
+    int64_t row = static_cast<int64_t>(start_row);
+    int64_t col = static_cast<int64_t>(start_col);
+    int dir = 0;
+    while (true) {
+        uint8_t& state = seen[static_cast<size_t>(row * cols + col)];
+        if (state & (1u << dir)) {
+            return false;
+        }
+        state |= static_cast<uint8_t>(1u << dir);
+
+        int64_t next_row = row + kDeltas[dir][0];
+        int64_t next_col = col + kDeltas[dir][1];
+        if (next_row < 0 || next_row >= rows || next_col < 0 || next_col >= cols) {
+            return true;
+        }
+        if (grid[next_row][next_col] == '#') {
+            dir = (dir + 1) % 4;
+        } else {
+            row = next_row;
+            col = next_col;
+        }
+    }
+}
+
+// Days 5 and 6: a `scale` x `scale` guard map whose patrol grows with the
+// map. Obstacles are laid out so the guard, starting near the middle and
+// facing up, spirals outwards: each leg runs about sqrt(scale) cells past
+// the one two turns before it, so the patrol covers about scale^1.5 cells
+// and makes about 2 * sqrt(scale) turns before it leaves the map. Sparse
+// random obstacles (1 in 500) are added off the patrol, where they only
+// matter to Day Six's candidate obstacles. Unlike the streamed days, the
+// grid and guardEscapes()'s visited states hold two scale^2 buffers.
+void generateGuardMap(uint64_t scale, Random& random, Output& out) {
+    static const int64_t kDeltas[4][2] = {{-1, 0}, {0, 1}, {1, 0}, {0, -1}};
+    if (scale < 8) {
+        throw std::invalid_argument("Error: guard maps need --scale of at least 8");
+    }
+    const int64_t size = static_cast<int64_t>(scale);
+    int64_t gap = 2;
+    while ((gap + 1) * (gap + 1) <= size) {
+        ++gap;
+    }
+
+    std::vector<std::string> grid(scale, std::string(scale, '.'));
+    uint64_t start_row = 0;
+    uint64_t start_col = 0;
+    do {
+        for (auto& row : grid) {
+            std::fill(row.begin(), row.end(), '.');
+        }
+        start_row = scale / 2 + random.below(scale / 8);
+        start_col = scale / 2 - random.below(scale / 8);
+
+        // Walk the spiral, marking the patrol with 'o' so the noise below
+        // can keep off it. A leg that would end off the map is the last.
+        int64_t row = static_cast<int64_t>(start_row);
+        int64_t col = static_cast<int64_t>(start_col);
+        grid[row][col] = 'o';
+        int64_t legs[2] = {gap, gap};
+        for (int dir = 0;; dir = (dir + 1) % 4) {
+            int64_t& length = legs[dir % 2];
+            int64_t end_row = row + kDeltas[dir][0] * length;
+            int64_t end_col = col + kDeltas[dir][1] * length;
+            bool inside = end_row >= 0 && end_row < size && end_col >= 0 && end_col < size;
+            int64_t steps = length;
+            if (!inside) {
+                steps = size;  // clipped at the edge below
+            }
+            for (int64_t i = 0; i < steps; ++i) {
+                row += kDeltas[dir][0];
+                col += kDeltas[dir][1];
+                if (row < 0 || row >= size || col < 0 || col >= size) {
+                    break;
+                }
+                grid[row][col] = 'o';
+            }
+            if (!inside) {
+                break;
+            }
+            int64_t block_row = row + kDeltas[dir][0];
+            int64_t block_col = col + kDeltas[dir][1];
+            if (block_row < 0 || block_row >= size || block_col < 0 || block_col >= size) {
+                break;  // the guard walks off from this corner instead
+            }
+            grid[block_row][block_col] = '#';
+            length += gap + static_cast<int64_t>(random.below(static_cast<uint64_t>(gap / 2) + 1));
+        }
+
+        for (auto& line : grid) {
+            for (auto& cell : line) {
+                if (cell == 'o') {
+                    cell = '.';
+                } else if (cell == '.' && random.chance(1, 500)) {
+                    cell = '#';
+                }
+            }
+        }
+    } while (!guardEscapes(grid, start_row, start_col));
+
+    grid[start_row][start_col] = '^';
+    for (const auto& row : grid) {
+        out.put(std::string_view(row));
+        out.put('\n');
+    }
+}
+
+// Day 7: `scale` calibration equations of 2-12 operands. About half are
+// built from a random +, * and || expression so they are solvable.
+void generateSeven(uint64_t scale, Random& random, Output& out) {
+    constexpr int64_t kLimit = 1'000'000'000'000'000;
+    for (uint64_t i = 0; i < scale; ++i) {
+        int count = static_cast<int>(random.between(2, 12));
+        std::vector<int64_t> numbers;
+        for (int j = 0; j < count; ++j) {
+            numbers.push_back(random.between(1, 99));
+        }
+
+        int64_t target = numbers[0];
+        for (int j = 1; j < count; ++j) {
+            int64_t next = numbers[j];
+            int64_t scale_up = next < 10 ? 10 : 100;
+            switch (random.below(3)) {
+                case 0:
+                    target += next;
+                    break;
+                case 1:
+                    target = target <= kLimit / next ? target * next : target + next;
+                    break;
+                default:
+                    target = target <= kLimit / scale_up ? target * scale_up + next : target + next;
+                    break;
+            }
+        }
+        if (random.chance(1, 2)) {
+            target += random.between(1, 1000);
+        }
+
+        out.number(target);
+        out.put(':');
+        for (int64_t number : numbers) {
+            out.put(' ');
+            out.number(number);
+        }
+        out.put('\n');
+    }
+}
+
+// Day 8: a `scale` x `scale` antenna map with a handful of antennas per
+// frequency.
+void generateEight(uint64_t scale, Random& random, Output& out) {
+    static const std::string_view kFrequencies =
+        "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    std::vector<std::string> grid(scale, std::string(scale, '.'));
+    uint64_t antennas = std::max<uint64_t>(2, scale * scale / 40);
+    for (uint64_t i = 0; i < antennas; ++i) {
+        grid[random.below(scale)][random.below(scale)] = kFrequencies[random.below(kFrequencies.size())];
+    }
+    for (const auto& row : grid) {
+        out.put(std::string_view(row));
+        out.put('\n');
+    }
+}
+
+// Day 9: a disk map of `scale` digits, alternating file and free lengths.
+void generateNine(uint64_t scale, Random& random, Output& out) {
+    for (uint64_t i = 0; i < scale; ++i) {
+        bool is_file = (i % 2 == 0);
+        out.put(static_cast<char>('0' + (is_file ? random.between(1, 9) : random.between(0, 9))));
+    }
+    out.put('\n');
+}
+
+// Day 10: a `scale` x `scale` topographic map. Heights rise along diagonal
+// bands with some noise, which leaves plenty of hiking trails.
+void generateTen(uint64_t scale, Random& random, Output& out) {
+    std::string row(scale, '0');
+    for (uint64_t r = 0; r < scale; ++r) {
+        for (uint64_t c = 0; c < scale; ++c) {
+            uint64_t height = r + c;
+            if (random.chance(1, 4)) {
+                height += random.below(10);
+            }
+            row[c] = static_cast<char>('0' + height % 10);
+        }
+        out.put(std::string_view(row));
+        out.put('\n');
+    }
+}
+
+// Day 11: a single line of `scale` engraved stones.
+void generateEleven(uint64_t scale, Random& random, Output& out) {
+    for (uint64_t i = 0; i < scale; ++i) {
+        if (i > 0) {
+            out.put(' ');
+        }
+        out.number(random.between(0, 9'999'999));
+    }
+    out.put('\n');
+}
+
+// Day 20: a `scale` x `scale` racetrack. The single track snakes back and
+// forth across the map; the walls between passes are one or two cells
+// thick at random, which is where the cheats are.
+void generateTwenty(uint64_t scale, Random& random, Output& out) {
+    if (scale < 5) {
+        throw std::invalid_argument("Error: racetracks need --scale of at least 5");
+    }
+    std::vector<std::string> grid(scale, std::string(scale, '#'));
+    const uint64_t left = 1;
+    const uint64_t right = scale - 2;
+
+    uint64_t row = 1;
+    bool heading_right = true;
+    grid[row][left] = 'S';
+    while (true) {
+        for (uint64_t c = left; c <= right; ++c) {
+            if (grid[row][c] != 'S') {
+                grid[row][c] = '.';
+            }
+        }
+        uint64_t gap = random.chance(1, 2) ? 1 : 2;
+        uint64_t next = row + gap + 1;
+        if (next > scale - 2) {
+            break;
+        }
+        uint64_t turn = heading_right ? right : left;
+        for (uint64_t r = row + 1; r < next; ++r) {
+            grid[r][turn] = '.';
+        }
+        row = next;
+        heading_right = !heading_right;
+    }
+    grid[row][heading_right ? right : left] = 'E';
+
+    for (const auto& line : grid) {
+        out.put(std::string_view(line));
+        out.put('\n');
+    }
+}
+
+struct Generator {
+    int day;
+    uint64_t default_scale;
+    const char* scale_meaning;
+    void (*generate)(uint64_t scale, Random& random, Output& out);
+};
+
+const std::vector<Generator>& generators() {
+    static const std::vector<Generator> all = {
+        {1, 1000, "rows", generateOne},
+        {2, 1000, "reports", generateTwo},
+        {3, 20000, "bytes", generateThree},
+        {4, 140, "grid side", generateFour},
+        {5, 130, "grid side", generateGuardMap},
+        {6, 130, "grid side", generateGuardMap},
+        {7, 850, "equations", generateSeven},
+        {8, 50, "grid side", generateEight},
+        {9, 19999, "digits", generateNine},
+        {10, 50, "grid side", generateTen},
+        {11, 8, "stones", generateEleven},
+        {20, 141, "grid side", generateTwenty},
+    };
+    return all;
+}
+
+uint64_t parseUnsigned(const std::string& flag, const std::string& value) {
+    if (value.empty() || value.size() > 19 || value.find_first_not_of("0123456789") != std::string::npos) {
+        throw std::invalid_argument("Error: " + flag + " expects a non-negative integer, got " + value);
+    }
+    return std::stoull(value);
+}
+
+std::string usage(const char* program) {
+    std::string text = "Usage: " + std::string(program) +
+        " <day> [--scale N] [--seed S] [--output PATH]\n\nDays and what --scale counts:\n";
+    for (const auto& generator : generators()) {
+        text += "  " + std::to_string(generator.day) + ": " + generator.scale_meaning +
+                " (default " + std::to_string(generator.default_scale) + ")\n";
+    }
+    return text;
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        const Generator* generator = nullptr;
+        std::optional<uint64_t> scale;
+        uint64_t seed = 2024;
+        std::string output_path;
+
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--scale" && i + 1 < argc) {
+                scale = parseUnsigned(arg, argv[++i]);
+            } else if (arg == "--seed" && i + 1 < argc) {
+                seed = parseUnsigned(arg, argv[++i]);
+            } else if (arg == "--output" && i + 1 < argc) {
+                output_path = argv[++i];
+            } else if (generator == nullptr && !arg.empty() && arg.size() <= 2 &&
+                       arg.find_first_not_of("0123456789") == std::string::npos) {
+                for (const auto& candidate : generators()) {
+                    if (candidate.day == std::stoi(arg)) {
+                        generator = &candidate;
+                    }
+                }
+                if (generator == nullptr) {
+                    throw std::invalid_argument(usage(argv[0]));
+                }
+            } else {
+                throw std::invalid_argument(usage(argv[0]));
+            }
+        }
+        if (generator == nullptr) {
+            throw std::invalid_argument(usage(argv[0]));
+        }
+
+        std::ofstream file;
+        if (!output_path.empty()) {
+            file.open(output_path, std::ios::binary);
+            if (!file.is_open()) {
+                throw std::runtime_error("Error: Could not open the file " + output_path);
+            }
+        }
+
+        Random random(seed);
+        Output out(output_path.empty() ? std::cout : file);
+        generator->generate(scale.value_or(generator->default_scale), random, out);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
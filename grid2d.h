@@ -0,0 +1,152 @@
+#ifndef ADVENT_GRID2D_H
+#define ADVENT_GRID2D_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string_view>
+#include <vector>
+
+#include "thread_pool.h"
+
+// Row-major grid in one contiguous allocation. An optional border of
+// sentinel cells surrounds the grid, so code that steps at most `border`
+// cells past an edge reads the sentinel instead of needing a bounds test.
+//
+// Cells are addressed either by (row, col), with (0, 0) the first interior
+// cell, or by linear index into the padded storage. Moving by (dr, dc) is a
+// constant offset on the linear index, see offset().
+template <typename T>
+class Grid2D {
+public:
+    Grid2D() = default;
+
+    Grid2D(int rows, int cols, const T& value = T{}, int border = 0, const T& border_value = T{}) {
+        assign(rows, cols, value, border, border_value);
+    }
+
+    // Builds a grid from text lines, converting each character with
+    // `convert`. The first line sets the width; short lines are padded with
+    // the border value.
+    template <typename Convert>
+    static Grid2D fromLines(const std::vector<std::string_view>& lines, Convert&& convert,
+                            int border = 0, const T& border_value = T{}) {
+        int rows = static_cast<int>(lines.size());
+        int cols = rows > 0 ? static_cast<int>(lines[0].size()) : 0;
+        Grid2D grid(rows, cols, border_value, border, border_value);
+        for (int r = 0; r < rows; ++r) {
+            int width = std::min(cols, static_cast<int>(lines[r].size()));
+            T* row = &grid(r, 0);
+            for (int c = 0; c < width; ++c) {
+                row[c] = convert(lines[r][c]);
+            }
+        }
+        return grid;
+    }
+
+    void assign(int rows, int cols, const T& value = T{}, int border = 0, const T& border_value = T{}) {
+        rows_ = rows;
+        cols_ = cols;
+        border_ = border;
+        stride_ = cols + 2 * border;
+        cells_.assign(static_cast<size_t>(rows + 2 * border) * stride_, border_value);
+        for (int r = 0; r < rows; ++r) {
+            std::fill_n(&(*this)(r, 0), cols, value);
+        }
+    }
+
+    void clear() {
+        rows_ = cols_ = border_ = stride_ = 0;
+        cells_.clear();
+    }
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int border() const { return border_; }
+    int stride() const { return stride_; }
+    bool empty() const { return rows_ == 0 || cols_ == 0; }
+
+    bool inBounds(int row, int col) const {
+        return row >= 0 && row < rows_ && col >= 0 && col < cols_;
+    }
+
+    size_t index(int row, int col) const {
+        return static_cast<size_t>(row + border_) * stride_ + (col + border_);
+    }
+
+    int rowOf(size_t index) const { return static_cast<int>(index / stride_) - border_; }
+    int colOf(size_t index) const { return static_cast<int>(index % stride_) - border_; }
+
+    // Linear-index distance of a (dr, dc) step
+    std::ptrdiff_t offset(int dr, int dc) const {
+        return static_cast<std::ptrdiff_t>(dr) * stride_ + dc;
+    }
+
+    // Offsets of the four orthogonal neighbours: up, right, down, left
+    std::array<std::ptrdiff_t, 4> neighbourOffsets() const {
+        return {-static_cast<std::ptrdiff_t>(stride_), 1, static_cast<std::ptrdiff_t>(stride_), -1};
+    }
+
+    T& operator()(int row, int col) { return cells_[index(row, col)]; }
+    const T& operator()(int row, int col) const { return cells_[index(row, col)]; }
+
+    T& operator[](size_t index) { return cells_[index]; }
+    const T& operator[](size_t index) const { return cells_[index]; }
+
+    // Padded storage, border included
+    T* data() { return cells_.data(); }
+    const T* data() const { return cells_.data(); }
+    size_t storageSize() const { return cells_.size(); }
+
+private:
+    int rows_ = 0;
+    int cols_ = 0;
+    int border_ = 0;
+    int stride_ = 0;
+    std::vector<T> cells_;
+};
+
+// A horizontal band of grid rows for tiled, parallel scans. The band owns
+// rows [begin, end): work anchored there is counted by this band and no
+// other. Patterns that reach past its edges read the neighbouring rows of
+// the shared grid directly, so bands need no copies of their own.
+struct RowBand {
+    int begin;
+    int end;
+};
+
+// Splits `rows` rows into at most `band_count` bands of near-equal height,
+// each at least `min_rows` tall (apart from a single band for tiny grids).
+inline std::vector<RowBand> splitRowBands(int rows, int band_count, int min_rows = 1) {
+    band_count = std::max(1, std::min(band_count, rows / std::max(min_rows, 1)));
+    std::vector<RowBand> bands;
+    for (int i = 0; i < band_count; ++i) {
+        int begin = static_cast<int>(static_cast<int64_t>(rows) * i / band_count);
+        int end = static_cast<int>(static_cast<int64_t>(rows) * (i + 1) / band_count);
+        if (begin < end) {
+            bands.push_back({begin, end});
+        }
+    }
+    return bands;
+}
+
+// Runs `count(band)` for every band on `pool` and adds up the results. As
+// each band only counts what is anchored in its own rows, the sum equals a
+// scan of the whole grid.
+template <typename F>
+int64_t sumRowBands(ThreadPool& pool, const std::vector<RowBand>& bands, F&& count) {
+    std::vector<std::future<int64_t>> pending;
+    pending.reserve(bands.size());
+    for (const RowBand& band : bands) {
+        pending.push_back(pool.submit([&count, band]() -> int64_t { return count(band); }));
+    }
+    int64_t total = 0;
+    for (auto& result : pending) {
+        total += result.get();
+    }
+    return total;
+}
+
+#endif // ADVENT_GRID2D_H
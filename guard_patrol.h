@@ -0,0 +1,282 @@
+#ifndef ADVENT_GUARD_PATROL_H
+#define ADVENT_GUARD_PATROL_H
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#include "grid2d.h"
+
+// Shared pieces of the guard patrol puzzles (Days Five and Six): the guard
+// walks straight until the cell ahead is an obstacle, then turns right, and
+// stops once it walks off the map.
+
+// Directions are 0..3 clockwise from up, so turning right is (dir + 1) & 3
+constexpr int kGuardUp = 0;
+constexpr int kGuardRight = 1;
+constexpr int kGuardDown = 2;
+constexpr int kGuardLeft = 3;
+constexpr int kGuardRowStep[4] = {-1, 0, 1, 0};
+constexpr int kGuardColStep[4] = {0, 1, 0, -1};
+
+inline int turnRight(int dir) { return (dir + 1) & 3; }
+
+// Direction of a guard marker ('^', '>', 'v', '<'), or -1
+inline int guardDirection(char marker) {
+    switch (marker) {
+        case '^': return kGuardUp;
+        case '>': return kGuardRight;
+        case 'v': return kGuardDown;
+        case '<': return kGuardLeft;
+        default: return -1;
+    }
+}
+
+// Where a straight walk ends: the last free cell before an obstacle, or the
+// last cell on the map when the guard walks off it. `obstacle` is the number
+// of the obstacle that stopped the guard, -1 when it exits.
+struct GuardStop {
+    int row;
+    int col;
+    bool exits;
+    int obstacle = -1;
+};
+
+// Obstacle positions per row and per column, sorted. A walk of any length
+// is then one binary search instead of a step per cell, and the index only
+// takes memory per obstacle, not per cell and direction, so it scales to
+// very large, sparse maps. Obstacles are numbered 0..count() - 1 in
+// row-major order.
+class ObstacleIndex {
+public:
+    ObstacleIndex() = default;
+
+    ObstacleIndex(const Grid2D<char>& grid, char obstacle = '#')
+        : rows_(grid.rows()), cols_(grid.cols()) {
+        std::vector<int> per_row(rows_ + 1, 0);
+        std::vector<int> per_col(cols_ + 1, 0);
+        for (int r = 0; r < rows_; ++r) {
+            const char* row = &grid(r, 0);
+            for (int c = 0; c < cols_; ++c) {
+                if (row[c] == obstacle) {
+                    ++per_row[r + 1];
+                    ++per_col[c + 1];
+                }
+            }
+        }
+        for (int r = 0; r < rows_; ++r) {
+            per_row[r + 1] += per_row[r];
+        }
+        for (int c = 0; c < cols_; ++c) {
+            per_col[c + 1] += per_col[c];
+        }
+
+        row_offsets = per_row;
+        col_offsets = per_col;
+        cols_in_row.resize(per_row[rows_]);
+        rows_in_col.resize(per_col[cols_]);
+        ids_in_col.resize(per_col[cols_]);
+        // Row-major order fills both lists already sorted
+        for (int r = 0; r < rows_; ++r) {
+            const char* row = &grid(r, 0);
+            for (int c = 0; c < cols_; ++c) {
+                if (row[c] == obstacle) {
+                    ids_in_col[per_col[c]] = per_row[r];
+                    cols_in_row[per_row[r]++] = c;
+                    rows_in_col[per_col[c]++] = r;
+                }
+            }
+        }
+    }
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+    int count() const { return static_cast<int>(cols_in_row.size()); }
+
+    // Walks from (row, col) in `dir` until the next obstacle or the edge
+    GuardStop slide(int row, int col, int dir) const {
+        switch (dir) {
+            case kGuardUp: {
+                const int* first = rows_in_col.data() + col_offsets[col];
+                const int* above = std::lower_bound(first, rows_in_col.data() + col_offsets[col + 1], row);
+                if (above == first) {
+                    return {0, col, true};
+                }
+                return {above[-1] + 1, col, false, ids_in_col[above - 1 - rows_in_col.data()]};
+            }
+            case kGuardDown: {
+                const int* last = rows_in_col.data() + col_offsets[col + 1];
+                const int* below = std::upper_bound(rows_in_col.data() + col_offsets[col], last, row);
+                if (below == last) {
+                    return {rows_ - 1, col, true};
+                }
+                return {*below - 1, col, false, ids_in_col[below - rows_in_col.data()]};
+            }
+            case kGuardRight: {
+                const int* last = cols_in_row.data() + row_offsets[row + 1];
+                const int* right = std::upper_bound(cols_in_row.data() + row_offsets[row], last, col);
+                if (right == last) {
+                    return {row, cols_ - 1, true};
+                }
+                return {row, *right - 1, false, static_cast<int>(right - cols_in_row.data())};
+            }
+            default: {
+                const int* first = cols_in_row.data() + row_offsets[row];
+                const int* left = std::lower_bound(first, cols_in_row.data() + row_offsets[row + 1], col);
+                if (left == first) {
+                    return {row, 0, true};
+                }
+                return {row, left[-1] + 1, false, static_cast<int>(left - 1 - cols_in_row.data())};
+            }
+        }
+    }
+
+private:
+    int rows_ = 0;
+    int cols_ = 0;
+    // Obstacle columns of row r: cols_in_row[row_offsets[r] .. row_offsets[r + 1])
+    std::vector<int> row_offsets;
+    std::vector<int> cols_in_row;
+    // Obstacle rows of column c: rows_in_col[col_offsets[c] .. col_offsets[c + 1])
+    std::vector<int> col_offsets;
+    std::vector<int> rows_in_col;
+    std::vector<int> ids_in_col;  // obstacle number of each rows_in_col entry
+};
+
+// An ObstacleIndex with one extra obstacle on top, for trying out a single
+// new obstacle without rebuilding the index. A walk asks the base index where
+// it stops, then only checks whether the extra obstacle cuts it short. The
+// extra obstacle is numbered base.count().
+class ObstacleOverlay {
+public:
+    ObstacleOverlay(const ObstacleIndex& base, int extra_row, int extra_col)
+        : base_(base), extra_row(extra_row), extra_col(extra_col) {}
+
+    GuardStop slide(int row, int col, int dir) const {
+        GuardStop stop = base_.slide(row, col, dir);
+        switch (dir) {
+            case kGuardUp:
+                if (extra_col == col && extra_row < row && extra_row >= stop.row) {
+                    return {extra_row + 1, col, false, base_.count()};
+                }
+                break;
+            case kGuardDown:
+                if (extra_col == col && extra_row > row && extra_row <= stop.row) {
+                    return {extra_row - 1, col, false, base_.count()};
+                }
+                break;
+            case kGuardRight:
+                if (extra_row == row && extra_col > col && extra_col <= stop.col) {
+                    return {row, extra_col - 1, false, base_.count()};
+                }
+                break;
+            default:
+                if (extra_row == row && extra_col < col && extra_col >= stop.col) {
+                    return {row, extra_col + 1, false, base_.count()};
+                }
+                break;
+        }
+        return stop;
+    }
+
+private:
+    const ObstacleIndex& base_;
+    int extra_row;
+    int extra_col;
+};
+
+// One bit per cell, row-major. Straight walks set whole runs of bits.
+class CellBitset {
+public:
+    CellBitset(int rows, int cols)
+        : cols_(cols), words((static_cast<size_t>(rows) * cols + 63) / 64, 0) {}
+
+    // Marks every cell from (row, col) to stop, inclusive
+    void markWalk(int row, int col, const GuardStop& stop) {
+        if (row == stop.row) {
+            size_t first = bitIndex(row, std::min(col, stop.col));
+            size_t last = bitIndex(row, std::max(col, stop.col));
+            setRange(first, last);
+        } else {
+            for (int r = std::min(row, stop.row); r <= std::max(row, stop.row); ++r) {
+                size_t bit = bitIndex(r, col);
+                words[bit >> 6] |= uint64_t{1} << (bit & 63);
+            }
+        }
+    }
+
+    // Sets the bit for (row, col); false if it was already set
+    bool insert(int row, int col) {
+        size_t bit = bitIndex(row, col);
+        uint64_t mask = uint64_t{1} << (bit & 63);
+        bool fresh = (words[bit >> 6] & mask) == 0;
+        words[bit >> 6] |= mask;
+        return fresh;
+    }
+
+    int64_t count() const {
+        int64_t total = 0;
+        for (uint64_t word : words) {
+            total += std::popcount(word);
+        }
+        return total;
+    }
+
+private:
+    int cols_;
+    std::vector<uint64_t> words;
+
+    size_t bitIndex(int row, int col) const {
+        return static_cast<size_t>(row) * cols_ + col;
+    }
+
+    // Sets bits [first, last]
+    void setRange(size_t first, size_t last) {
+        size_t first_word = first >> 6;
+        size_t last_word = last >> 6;
+        uint64_t head = ~uint64_t{0} << (first & 63);
+        uint64_t tail = ~uint64_t{0} >> (63 - (last & 63));
+        if (first_word == last_word) {
+            words[first_word] |= head & tail;
+            return;
+        }
+        words[first_word] |= head;
+        std::fill(words.begin() + first_word + 1, words.begin() + last_word, ~uint64_t{0});
+        words[last_word] |= tail;
+    }
+};
+
+// Turns already taken on repeated patrols over one map, keyed by the
+// obstacle the guard stopped at and its direction: that pair fixes the cell
+// it turned in, so memory grows with the obstacles rather than the cells.
+// Each entry holds the generation that last visited it, so starting a new
+// patrol is a counter bump instead of a clear.
+class GuardStateStamps {
+public:
+    explicit GuardStateStamps(int obstacle_count)
+        : stamps(static_cast<size_t>(obstacle_count) * 4, 0) {}
+
+    void nextGeneration() {
+        if (++generation == 0) {
+            std::fill(stamps.begin(), stamps.end(), 0);
+            generation = 1;
+        }
+    }
+
+    // Records the turn; false if this generation has already taken it
+    bool visit(int obstacle, int dir) {
+        uint32_t& stamp = stamps[static_cast<size_t>(obstacle) * 4 + dir];
+        if (stamp == generation) {
+            return false;
+        }
+        stamp = generation;
+        return true;
+    }
+
+private:
+    uint32_t generation = 0;
+    std::vector<uint32_t> stamps;
+};
+
+#endif // ADVENT_GUARD_PATROL_H
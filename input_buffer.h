@@ -0,0 +1,287 @@
+#ifndef ADVENT_INPUT_BUFFER_H
+#define ADVENT_INPUT_BUFFER_H
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Splits text the way std::getline does: on '\n', with a trailing newline
+// not producing an extra empty line. Lines are views into the original text.
+class Lines {
+public:
+    explicit Lines(std::string_view text) : text(text) {}
+
+    class iterator {
+    public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(std::string_view text) : text(text) { advance(); }
+
+        std::string_view operator*() const { return line; }
+        iterator& operator++() { advance(); return *this; }
+        void operator++(int) { advance(); }
+        bool operator==(std::default_sentinel_t) const { return done; }
+
+    private:
+        std::string_view text;
+        std::string_view line;
+        size_t next = 0;
+        bool done = false;
+
+        void advance() {
+            if (next >= text.size()) {
+                done = true;
+                return;
+            }
+            size_t newline = text.find('\n', next);
+            if (newline == std::string_view::npos) {
+                newline = text.size();
+            }
+            line = text.substr(next, newline - next);
+            next = newline + 1;
+        }
+    };
+
+    iterator begin() const { return iterator(text); }
+    std::default_sentinel_t end() const { return {}; }
+
+private:
+    std::string_view text;
+};
+
+// Splits text on whitespace, like repeated `stream >> std::string`.
+class Tokens {
+public:
+    explicit Tokens(std::string_view text) : text(text) {}
+
+    class iterator {
+    public:
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(std::string_view text) : text(text) { advance(); }
+
+        std::string_view operator*() const { return token; }
+        iterator& operator++() { advance(); return *this; }
+        void operator++(int) { advance(); }
+        bool operator==(std::default_sentinel_t) const { return done; }
+
+    private:
+        std::string_view text;
+        std::string_view token;
+        size_t next = 0;
+        bool done = false;
+
+        static bool isSpace(char c) {
+            return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+        }
+
+        void advance() {
+            while (next < text.size() && isSpace(text[next])) {
+                ++next;
+            }
+            if (next >= text.size()) {
+                done = true;
+                return;
+            }
+            size_t start = next;
+            while (next < text.size() && !isSpace(text[next])) {
+                ++next;
+            }
+            token = text.substr(start, next - start);
+        }
+    };
+
+    iterator begin() const { return iterator(text); }
+    std::default_sentinel_t end() const { return {}; }
+
+private:
+    std::string_view text;
+};
+
+// Cuts text into at most `parts` pieces of similar size, each ending just
+// after a newline (the last at the end of the text), so no line is split.
+// Pieces are never shorter than `min_bytes` apart from the last.
+inline std::vector<std::string_view> splitAtNewlines(std::string_view text, size_t parts,
+                                                     size_t min_bytes = 0) {
+    std::vector<std::string_view> pieces;
+    if (parts == 0) {
+        parts = 1;
+    }
+    size_t target = std::max(text.size() / parts + 1, min_bytes);
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t cut = start + target;
+        if (cut >= text.size()) {
+            cut = text.size();
+        } else {
+            size_t newline = text.find('\n', cut - 1);
+            cut = newline == std::string_view::npos ? text.size() : newline + 1;
+        }
+        pieces.push_back(text.substr(start, cut - start));
+        start = cut;
+    }
+    return pieces;
+}
+
+// Read-only, memory-mapped view of an input file. The file is mapped once
+// and every consumer reads straight out of the mapping. Inputs that are not
+// regular files (pipes, /dev/stdin) are read into a buffer instead.
+class InputBuffer {
+public:
+    InputBuffer() = default;
+    ~InputBuffer() { close(); }
+
+    InputBuffer(const InputBuffer&) = delete;
+    InputBuffer& operator=(const InputBuffer&) = delete;
+
+    InputBuffer(InputBuffer&& other) noexcept
+        : data(std::exchange(other.data, nullptr)),
+          length(std::exchange(other.length, 0)),
+          mapped(std::exchange(other.mapped, false)),
+          opened(std::exchange(other.opened, false)),
+          owned(std::move(other.owned)) {
+        pointAtOwned();
+    }
+
+    InputBuffer& operator=(InputBuffer&& other) noexcept {
+        if (this != &other) {
+            close();
+            data = std::exchange(other.data, nullptr);
+            length = std::exchange(other.length, 0);
+            mapped = std::exchange(other.mapped, false);
+            opened = std::exchange(other.opened, false);
+            owned = std::move(other.owned);
+            pointAtOwned();
+        }
+        return *this;
+    }
+
+    bool open(const std::string& path) {
+        close();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat info {};
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            return false;
+        }
+
+        // Pipes, FIFOs and terminals report no size and cannot be mapped
+        if (!S_ISREG(info.st_mode)) {
+            bool read_all = readAll(fd);
+            ::close(fd);
+            if (!read_all) {
+                close();
+                return false;
+            }
+            opened = true;
+            return true;
+        }
+
+        length = static_cast<size_t>(info.st_size);
+        if (length > 0) {
+            void* address = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED) {
+                ::close(fd);
+                length = 0;
+                return false;
+            }
+            ::madvise(address, length, MADV_SEQUENTIAL);
+            data = static_cast<const char*>(address);
+            mapped = true;
+        }
+
+        // The mapping stays valid after the descriptor is closed
+        ::close(fd);
+        opened = true;
+        return true;
+    }
+
+    void close() {
+        if (mapped) {
+            ::munmap(const_cast<char*>(data), length);
+        }
+        data = nullptr;
+        length = 0;
+        mapped = false;
+        opened = false;
+        owned = {};
+    }
+
+    // Faults the whole mapping in, so a loader thread can pay for the disk
+    // reads before the file is handed to a solver.
+    void prefault() const {
+        if (!mapped) {
+            return;
+        }
+        ::madvise(const_cast<char*>(data), length, MADV_WILLNEED);
+        const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        volatile char sink = 0;
+        for (size_t offset = 0; offset < length; offset += page) {
+            sink = sink + data[offset];
+        }
+    }
+
+    bool isOpen() const { return opened; }
+    size_t size() const { return length; }
+    std::string_view view() const { return {data, length}; }
+
+    Lines lines() const { return Lines(view()); }
+    Tokens tokens() const { return Tokens(view()); }
+
+private:
+    const char* data = nullptr;
+    size_t length = 0;
+    bool mapped = false;
+    bool opened = false;
+    // Contents of inputs that could not be mapped
+    std::string owned;
+
+    bool readAll(int fd) {
+        char block[1 << 16];
+        while (true) {
+            ssize_t count = ::read(fd, block, sizeof(block));
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            if (count < 0) {
+                return false;
+            }
+            if (count == 0) {
+                break;
+            }
+            owned.append(block, static_cast<size_t>(count));
+        }
+        pointAtOwned();
+        return true;
+    }
+
+    // A moved string may have moved its characters (short strings live
+    // inside the object), so the view is re-pointed after every move.
+    void pointAtOwned() {
+        if (!mapped && !owned.empty()) {
+            data = owned.data();
+            length = owned.size();
+        }
+    }
+};
+
+#endif // ADVENT_INPUT_BUFFER_H
@@ -0,0 +1,108 @@
+#ifndef ADVENT_INT_SCANNER_H
+#define ADVENT_INT_SCANNER_H
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Walks a text buffer pulling out integers line by line, without
+// allocating or going through iostreams. Anything that is not a digit, a
+// '-' directly before a digit, or a newline is treated as a separator, so
+// "190: 10 19" and "3   4" both scan as plain number lists.
+//
+//     IntScanner scanner(text);
+//     while (!scanner.atEnd()) {
+//         int value;
+//         while (scanner.next(value)) { ... }
+//         scanner.nextLine();
+//     }
+//
+// Lines follow std::getline: a trailing newline does not start another line.
+class IntScanner {
+public:
+    explicit IntScanner(std::string_view text)
+        : cursor(text.data()), limit(text.data() + text.size()) {}
+
+    bool atEnd() const { return cursor == limit; }
+
+    // Reads the next number on the current line. Returns false, without
+    // consuming the newline, once the line has no numbers left.
+    template <typename T>
+    bool next(T& value) {
+        while (cursor != limit) {
+            char c = *cursor;
+            if (isDigit(c) || (c == '-' && cursor + 1 != limit && isDigit(cursor[1]))) {
+                break;
+            }
+            if (c == '\n') {
+                return false;
+            }
+            ++cursor;
+        }
+        if (cursor == limit) {
+            return false;
+        }
+
+        const char* start = cursor;
+        const char* digits = (*start == '-') ? start + 1 : start;
+        const char* end = digitRunEnd(digits);
+        auto [stop, ec] = std::from_chars(start, end, value);
+        if (ec != std::errc()) {
+            throw std::out_of_range("Error: number out of range: " + std::string(start, end));
+        }
+        cursor = stop;
+        return true;
+    }
+
+    // Skips whatever is left of the current line, newline included. Returns
+    // false when there was no line left to skip.
+    bool nextLine() {
+        if (cursor == limit) {
+            return false;
+        }
+        const void* newline = std::memchr(cursor, '\n', static_cast<size_t>(limit - cursor));
+        cursor = newline ? static_cast<const char*>(newline) + 1 : limit;
+        return true;
+    }
+
+private:
+    const char* cursor;
+    const char* limit;
+
+    static bool isDigit(char c) {
+        return static_cast<unsigned char>(c - '0') < 10;
+    }
+
+    // End of the run of digits starting at `p`, sixteen bytes at a time
+    // where the platform allows it.
+    const char* digitRunEnd(const char* p) const {
+#if defined(__SSE2__)
+        const __m128i below_zero = _mm_set1_epi8('0' - 1);
+        const __m128i above_nine = _mm_set1_epi8('9' + 1);
+        while (limit - p >= 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(chunk, below_zero),
+                                           _mm_cmplt_epi8(chunk, above_nine));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(digits));
+            if (mask != 0xFFFF) {
+                return p + __builtin_ctz(~mask);
+            }
+            p += 16;
+        }
+#endif
+        while (p != limit && isDigit(*p)) {
+            ++p;
+        }
+        return p;
+    }
+};
+
+#endif // ADVENT_INT_SCANNER_H
@@ -0,0 +1,67 @@
+#ifndef ADVENT_RADIX_SORT_H
+#define ADVENT_RADIX_SORT_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// LSD radix sort for 32-bit integers, one byte per pass. The histograms for
+// all four bytes are gathered in a single read of the input, and a pass is
+// skipped when every key has the same byte there, so inputs spanning a small
+// range of values need fewer than four scatters. Signed keys are ordered by
+// flipping the sign bit. `scratch` is resized to match and may be reused.
+template <typename T>
+void radixSort(std::vector<T>& values, std::vector<T>& scratch) {
+    static_assert(std::is_integral_v<T> && sizeof(T) == 4, "radixSort handles 32-bit integers");
+    constexpr uint32_t kFlip = std::is_signed_v<T> ? 0x80000000u : 0u;
+    const size_t n = values.size();
+    if (n < 2) {
+        return;
+    }
+
+    std::array<std::array<size_t, 256>, 4> counts{};
+    for (T value : values) {
+        uint32_t key = static_cast<uint32_t>(value) ^ kFlip;
+        ++counts[0][key & 0xFF];
+        ++counts[1][(key >> 8) & 0xFF];
+        ++counts[2][(key >> 16) & 0xFF];
+        ++counts[3][key >> 24];
+    }
+
+    scratch.resize(n);
+    T* source = values.data();
+    T* target = scratch.data();
+    for (int pass = 0; pass < 4; ++pass) {
+        auto& count = counts[pass];
+        const int shift = pass * 8;
+        uint32_t first_byte = ((static_cast<uint32_t>(source[0]) ^ kFlip) >> shift) & 0xFF;
+        if (count[first_byte] == n) {
+            continue;
+        }
+
+        size_t position = 0;
+        for (auto& bucket : count) {
+            position += std::exchange(bucket, position);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t byte = ((static_cast<uint32_t>(source[i]) ^ kFlip) >> shift) & 0xFF;
+            target[count[byte]++] = source[i];
+        }
+        std::swap(source, target);
+    }
+
+    if (source != values.data()) {
+        values.swap(scratch);
+    }
+}
+
+template <typename T>
+void radixSort(std::vector<T>& values) {
+    std::vector<T> scratch;
+    radixSort(values, scratch);
+}
+
+#endif // ADVENT_RADIX_SORT_H
@@ -0,0 +1,98 @@
+#ifndef ADVENT_RESULT_WRITER_H
+#define ADVENT_RESULT_WRITER_H
+
+#include <charconv>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "advent_day.h"
+
+// Formats DayResults into an in-memory buffer and hands it to the stream in
+// one write per flush(), so the days themselves never touch iostreams.
+class ResultWriter {
+public:
+    explicit ResultWriter(std::ostream& stream) : stream(stream) {}
+
+    ~ResultWriter() { flush(); }
+
+    ResultWriter(const ResultWriter&) = delete;
+    ResultWriter& operator=(const ResultWriter&) = delete;
+
+    void write(int day_number, const DayResult& result) {
+        append("Day ");
+        appendNumber(day_number);
+        append("\n");
+        appendResult(result);
+    }
+
+    // Batch runs label each result with the input it came from
+    void write(std::string_view heading, const DayResult& result) {
+        append(heading);
+        append("\n");
+        appendResult(result);
+    }
+
+    // Messages carry their own "Error: " prefix, as the days throw them
+    void writeError(int day_number, std::string_view message) {
+        append("Day ");
+        appendNumber(day_number);
+        append("\n  ");
+        append(message);
+        append("\n");
+    }
+
+    void writeError(std::string_view heading, std::string_view message) {
+        append(heading);
+        append("\n  ");
+        append(message);
+        append("\n");
+    }
+
+    void flush() {
+        if (!buffer.empty()) {
+            stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+        stream.flush();
+    }
+
+private:
+    std::ostream& stream;
+    std::string buffer;
+
+    void appendResult(const DayResult& result) {
+        if (result.part_one) {
+            append("  Part One: ");
+            appendNumber(*result.part_one);
+            append("\n");
+        }
+        if (result.part_two) {
+            append("  Part Two: ");
+            appendNumber(*result.part_two);
+            append("\n");
+        }
+        for (const auto& diagnostic : result.diagnostics) {
+            append("  ");
+            append(diagnostic.label);
+            if (diagnostic.value) {
+                append(": ");
+                appendNumber(*diagnostic.value);
+            }
+            append("\n");
+        }
+    }
+
+    void append(std::string_view text) {
+        buffer.append(text);
+    }
+
+    void appendNumber(int64_t value) {
+        char digits[24];
+        char* end = std::to_chars(digits, digits + sizeof(digits), value).ptr;
+        buffer.append(digits, end);
+    }
+};
+
+#endif // ADVENT_RESULT_WRITER_H
@@ -0,0 +1,157 @@
+#ifndef ADVENT_THREAD_POOL_H
+#define ADVENT_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Fixed-size, work-stealing pool of worker threads. Every worker has its own
+// task deque: tasks submitted from outside are dealt round-robin, tasks a
+// worker submits go on its own deque. A worker takes the newest task from
+// its own deque and, once that is empty, steals the oldest from another, so
+// uneven tasks still keep every thread busy. Submitting and taking tasks
+// only lock the deques involved; the pool-wide mutex is only used by workers
+// that found every deque empty and go to sleep, and by whoever wakes them.
+// The destructor drains whatever is still queued before joining.
+class ThreadPool {
+public:
+    explicit ThreadPool(unsigned thread_count) {
+        if (thread_count == 0) {
+            thread_count = 1;
+        }
+        queues.reserve(thread_count);
+        for (unsigned i = 0; i < thread_count; ++i) {
+            queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        workers.reserve(thread_count);
+        for (unsigned i = 0; i < thread_count; ++i) {
+            workers.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    template <typename F>
+    auto submit(F&& task) -> std::future<std::invoke_result_t<F>> {
+        using Result = std::invoke_result_t<F>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> result = packaged->get_future();
+        int self = workerIndex();
+        unsigned target = self >= 0 ? static_cast<unsigned>(self)
+                                    : next_queue.fetch_add(1, std::memory_order_relaxed) % size();
+        {
+            std::lock_guard<std::mutex> lock(queues[target]->mutex);
+            queues[target]->tasks.emplace_back([packaged] { (*packaged)(); });
+        }
+        queued.fetch_add(1);
+        // A worker about to sleep holds `mutex` from its last look at
+        // `queued` until it waits, so taking the lock here cannot slip a
+        // wake-up in between. Both atomics are sequentially consistent: if
+        // we read no sleepers, any later sleeper sees our task.
+        if (sleeping.load() > 0) {
+            std::lock_guard<std::mutex> lock(mutex);
+        }
+        wake.notify_one();
+        return result;
+    }
+
+    unsigned size() const {
+        // Not workers.size(): workers already run while the rest are started
+        return static_cast<unsigned>(queues.size());
+    }
+
+    // Index in [0, size()) of the calling thread if it is one of this pool's
+    // workers, else -1. Lets tasks pick per-worker scratch space.
+    int workerIndex() const {
+        return current_pool == this ? current_index : -1;
+    }
+
+    static unsigned defaultThreadCount() {
+        unsigned hardware = std::thread::hardware_concurrency();
+        return hardware == 0 ? 1 : hardware;
+    }
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<unsigned> next_queue{0};
+    // Tasks sitting in the deques, and workers asleep or about to be
+    std::atomic<size_t> queued{0};
+    std::atomic<unsigned> sleeping{0};
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    static inline thread_local const ThreadPool* current_pool = nullptr;
+    static inline thread_local int current_index = -1;
+
+    // Newest task of our own deque, else the oldest of another worker's
+    bool tryTake(unsigned index, std::function<void()>& task) {
+        {
+            WorkerQueue& own = *queues[index];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        for (unsigned offset = 1; offset < size(); ++offset) {
+            WorkerQueue& victim = *queues[(index + offset) % size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(unsigned index) {
+        current_pool = this;
+        current_index = static_cast<int>(index);
+        while (true) {
+            std::function<void()> task;
+            if (tryTake(index, task)) {
+                task();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            sleeping.fetch_add(1);
+            wake.wait(lock, [this] { return stopping || queued.load() > 0; });
+            sleeping.fetch_sub(1);
+            if (stopping && queued.load() == 0) {
+                return;
+            }
+        }
+    }
+};
+
+#endif // ADVENT_THREAD_POOL_H
@@ -0,0 +1,177 @@
+#ifndef ADVENT_TRACE_H
+#define ADVENT_TRACE_H
+
+// Scoped timers and counters for the hot paths. They only exist when the
+// build defines ADVENT_TRACE (cmake -DADVENT_TRACE=ON); otherwise the macros
+// expand to nothing and the solvers carry no cost.
+//
+//     ADVENT_TRACE_SCOPE("Six::causesLoop");              // span until end of scope
+//     ADVENT_TRACE_SCOPE_ARG("parse", input_file_path);  // span with a detail string
+//     ADVENT_TRACE_COUNTER("Eleven distinct stones", n);  // sampled value
+//
+// Names must be string literals. Each thread records into its own buffer;
+// trace::writeChromeTrace() exports every buffer as Chrome trace-event JSON
+// (chrome://tracing, Perfetto) and must only run once traced work is done.
+
+#ifdef ADVENT_TRACE
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace trace {
+
+struct Event {
+    const char* name;
+    char phase;          // 'X' complete span, 'C' counter sample
+    int64_t start_ns;
+    int64_t value;       // duration for spans, sample for counters
+    std::string detail;
+};
+
+struct ThreadBuffer {
+    uint32_t tid;
+    std::vector<Event> events;
+};
+
+class Recorder {
+public:
+    static Recorder& instance() {
+        static Recorder recorder;
+        return recorder;
+    }
+
+    // Buffers outlive their threads, so pool workers can be joined before
+    // the export.
+    ThreadBuffer& threadBuffer() {
+        thread_local ThreadBuffer* buffer = nullptr;
+        if (buffer == nullptr) {
+            std::lock_guard<std::mutex> lock(mutex);
+            buffers.push_back(std::make_unique<ThreadBuffer>());
+            buffer = buffers.back().get();
+            buffer->tid = static_cast<uint32_t>(buffers.size());
+        }
+        return *buffer;
+    }
+
+    int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - epoch).count();
+    }
+
+    void writeChromeTrace(std::ostream& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool first = true;
+        auto separator = [&] {
+            out << (first ? "\n" : ",\n");
+            first = false;
+        };
+        for (const auto& buffer : buffers) {
+            separator();
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid
+                << ",\"args\":{\"name\":\"thread " << buffer->tid << "\"}}";
+            for (const auto& event : buffer->events) {
+                separator();
+                out << "{\"name\":";
+                writeString(out, event.name);
+                out << ",\"ph\":\"" << event.phase << "\",\"pid\":1,\"tid\":" << buffer->tid
+                    << ",\"ts\":";
+                writeMicroseconds(out, event.start_ns);
+                if (event.phase == 'X') {
+                    out << ",\"dur\":";
+                    writeMicroseconds(out, event.value);
+                    if (!event.detail.empty()) {
+                        out << ",\"args\":{\"detail\":";
+                        writeString(out, event.detail);
+                        out << "}";
+                    }
+                } else {
+                    out << ",\"args\":{\"value\":" << event.value << "}";
+                }
+                out << "}";
+            }
+        }
+        out << "\n]}\n";
+    }
+
+private:
+    std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+    // Trace timestamps are microseconds; keep the nanosecond digits
+    static void writeMicroseconds(std::ostream& out, int64_t ns) {
+        int64_t fraction = ns % 1000;
+        out << ns / 1000 << '.' << static_cast<char>('0' + fraction / 100)
+            << static_cast<char>('0' + fraction / 10 % 10) << static_cast<char>('0' + fraction % 10);
+    }
+
+    static void writeString(std::ostream& out, std::string_view text) {
+        out << '"';
+        for (char c : text) {
+            if (c == '"' || c == '\\') {
+                out << '\\' << c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                out << ' ';
+            } else {
+                out << c;
+            }
+        }
+        out << '"';
+    }
+};
+
+class Span {
+public:
+    explicit Span(const char* name, std::string_view detail = {})
+        : name(name), detail(detail), start(Recorder::instance().now()) {}
+
+    ~Span() {
+        Recorder& recorder = Recorder::instance();
+        int64_t end = recorder.now();
+        recorder.threadBuffer().events.push_back({name, 'X', start, end - start, std::string(detail)});
+    }
+
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+
+private:
+    const char* name;
+    std::string_view detail;
+    int64_t start;
+};
+
+inline void counter(const char* name, int64_t value) {
+    Recorder& recorder = Recorder::instance();
+    recorder.threadBuffer().events.push_back({name, 'C', recorder.now(), value, {}});
+}
+
+inline void writeChromeTrace(std::ostream& out) {
+    Recorder::instance().writeChromeTrace(out);
+}
+
+} // namespace trace
+
+#define ADVENT_TRACE_CONCAT_INNER(a, b) a##b
+#define ADVENT_TRACE_CONCAT(a, b) ADVENT_TRACE_CONCAT_INNER(a, b)
+#define ADVENT_TRACE_SCOPE(name) \
+    ::trace::Span ADVENT_TRACE_CONCAT(advent_trace_span_, __LINE__)(name)
+#define ADVENT_TRACE_SCOPE_ARG(name, detail) \
+    ::trace::Span ADVENT_TRACE_CONCAT(advent_trace_span_, __LINE__)(name, detail)
+#define ADVENT_TRACE_COUNTER(name, value) ::trace::counter(name, static_cast<int64_t>(value))
+
+#else
+
+#define ADVENT_TRACE_SCOPE(name) static_cast<void>(0)
+#define ADVENT_TRACE_SCOPE_ARG(name, detail) static_cast<void>(0)
+#define ADVENT_TRACE_COUNTER(name, value) static_cast<void>(0)
+
+#endif // ADVENT_TRACE
+
+#endif // ADVENT_TRACE_H